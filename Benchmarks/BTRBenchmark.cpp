@@ -0,0 +1,325 @@
+//
+//  BTRBenchmark.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRBenchmark.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+
+namespace btr {
+namespace benchmark {
+
+static std::vector<Benchmark> &Registry() {
+	static std::vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+void Register(const std::string &name, Function function) {
+	std::vector<Benchmark> &benchmarks = Registry();
+	Benchmark benchmark = { name, function };
+	auto position = std::lower_bound(benchmarks.begin(), benchmarks.end(), name, [](const Benchmark &b, const std::string &n) { return b.name < n; });
+	if (position != benchmarks.end() && position->name == name) {
+		std::fprintf(stderr, "Duplicate benchmark: %s\n", name.c_str());
+		std::abort();
+	}
+	benchmarks.insert(position, benchmark);
+}
+
+const std::vector<Benchmark> &RegisteredBenchmarks() {
+	return Registry();
+}
+
+// Running
+
+typedef std::chrono::steady_clock Clock;
+
+static double MeasureSeconds(const Function &function, size_t iterations) {
+	Clock::time_point start = Clock::now();
+	function(iterations);
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Doubles the iteration count until a repetition lasts long enough to be
+// measured reliably, then scales it to the target duration.
+static size_t CalibrateIterations(const Function &function, double minimumTime) {
+	size_t iterations = 1;
+	while (true) {
+		double elapsed = MeasureSeconds(function, iterations);
+		if (elapsed >= minimumTime / 10 || iterations >= (size_t)1 << 30) {
+			double perIteration = std::max(elapsed / iterations, 1e-12);
+			return std::max((size_t)1, (size_t)std::ceil(minimumTime / perIteration));
+		}
+		iterations *= 2;
+	}
+}
+
+double Percentile(std::vector<double> samples, double percentile) {
+	if (samples.empty()) return 0;
+	std::sort(samples.begin(), samples.end());
+	double rank = percentile / 100.0 * (samples.size() - 1);
+	size_t lower = (size_t)std::floor(rank);
+	size_t upper = std::min(lower + 1, samples.size() - 1);
+	return samples[lower] + (samples[upper] - samples[lower]) * (rank - lower);
+}
+
+static void ComputeStatistics(Result &result) {
+	const std::vector<double> &samples = result.samples;
+	double sum = 0;
+	for (double sample : samples) sum += sample;
+	result.mean = sum / samples.size();
+	
+	double squares = 0;
+	for (double sample : samples) squares += (sample - result.mean) * (sample - result.mean);
+	result.standardDeviation = samples.size() > 1 ? std::sqrt(squares / (samples.size() - 1)) : 0;
+	
+	result.minimum = *std::min_element(samples.begin(), samples.end());
+	result.maximum = *std::max_element(samples.begin(), samples.end());
+	result.median = Percentile(samples, 50);
+	result.p90 = Percentile(samples, 90);
+	result.p99 = Percentile(samples, 99);
+}
+
+std::vector<Result> Run(const Options &options) {
+	std::vector<Result> results;
+	for (const Benchmark &benchmark : RegisteredBenchmarks()) {
+		if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) continue;
+		
+		Result result;
+		result.name = benchmark.name;
+		result.iterations = CalibrateIterations(benchmark.function, options.minimumRepetitionTime);
+		for (size_t repetition = 0; repetition < std::max(options.repetitions, (size_t)1); repetition++) {
+			double elapsed = MeasureSeconds(benchmark.function, result.iterations);
+			result.samples.push_back(elapsed * 1e9 / result.iterations);
+		}
+		ComputeStatistics(result);
+		results.push_back(result);
+	}
+	return results;
+}
+
+// JSON output
+
+static std::string EscapeJSONString(const std::string &string) {
+	std::string escaped;
+	for (char c : string) {
+		switch (c) {
+			case '"': escaped += "\\\""; break;
+			case '\\': escaped += "\\\\"; break;
+			case '\n': escaped += "\\n"; break;
+			case '\t': escaped += "\\t"; break;
+			default:
+				if ((unsigned char)c < 0x20) {
+					char buffer[8];
+					std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+					escaped += buffer;
+				} else {
+					escaped += c;
+				}
+		}
+	}
+	return escaped;
+}
+
+static std::string FormatNumber(double value) {
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+	return buffer;
+}
+
+std::string ResultsToJSON(const std::vector<Result> &results, const Options &options) {
+	std::ostringstream json;
+	json << "{\n";
+	json << "  \"repetitions\": " << options.repetitions << ",\n";
+	json << "  \"minimum_repetition_time_s\": " << options.minimumRepetitionTime << ",\n";
+	json << "  \"benchmarks\": [";
+	for (size_t i = 0; i < results.size(); i++) {
+		const Result &result = results[i];
+		json << (i > 0 ? "," : "") << "\n    {\n";
+		json << "      \"name\": \"" << EscapeJSONString(result.name) << "\",\n";
+		json << "      \"iterations\": " << result.iterations << ",\n";
+		json << "      \"unit\": \"ns/op\",\n";
+		json << "      \"mean\": " << FormatNumber(result.mean) << ",\n";
+		json << "      \"stddev\": " << FormatNumber(result.standardDeviation) << ",\n";
+		json << "      \"min\": " << FormatNumber(result.minimum) << ",\n";
+		json << "      \"max\": " << FormatNumber(result.maximum) << ",\n";
+		json << "      \"median\": " << FormatNumber(result.median) << ",\n";
+		json << "      \"p90\": " << FormatNumber(result.p90) << ",\n";
+		json << "      \"p99\": " << FormatNumber(result.p99) << ",\n";
+		json << "      \"samples\": [";
+		for (size_t j = 0; j < result.samples.size(); j++) {
+			json << (j > 0 ? ", " : "") << FormatNumber(result.samples[j]);
+		}
+		json << "]\n    }";
+	}
+	json << "\n  ]\n}\n";
+	return json.str();
+}
+
+// Baseline parsing
+//
+// A minimal JSON reader, sufficient for reading back the output above. It only
+// keeps the name and median of each benchmark.
+
+namespace {
+
+class BaselineParser {
+public:
+	explicit BaselineParser(const std::string &json) : json_(json), position_(0) {}
+	
+	bool Parse(std::map<std::string, double> &medians, std::string &error) {
+		medians_ = &medians;
+		if (!ParseValue(0) || (SkipWhitespace(), position_ != json_.size())) {
+			error = error_.empty() ? "unexpected trailing characters" : error_;
+			return false;
+		}
+		return true;
+	}
+	
+private:
+	const std::string &json_;
+	size_t position_;
+	std::string error_;
+	std::map<std::string, double> *medians_;
+	
+	bool Fail(const std::string &message) {
+		if (error_.empty()) error_ = message + " at offset " + std::to_string(position_);
+		return false;
+	}
+	
+	void SkipWhitespace() {
+		while (position_ < json_.size() && std::isspace((unsigned char)json_[position_])) position_++;
+	}
+	
+	bool Consume(char c) {
+		SkipWhitespace();
+		if (position_ < json_.size() && json_[position_] == c) {
+			position_++;
+			return true;
+		}
+		return false;
+	}
+	
+	bool ParseString(std::string &string) {
+		if (!Consume('"')) return Fail("expected string");
+		while (position_ < json_.size() && json_[position_] != '"') {
+			char c = json_[position_++];
+			if (c == '\\') {
+				if (position_ >= json_.size()) break;
+				char escaped = json_[position_++];
+				switch (escaped) {
+					case 'n': c = '\n'; break;
+					case 't': c = '\t'; break;
+					case 'u': position_ += 4; c = '?'; break;
+					default: c = escaped; break;
+				}
+			}
+			string += c;
+		}
+		if (position_ >= json_.size()) return Fail("unterminated string");
+		position_++;
+		return true;
+	}
+	
+	bool ParseNumber(double &number) {
+		SkipWhitespace();
+		const char *start = json_.c_str() + position_;
+		char *end = nullptr;
+		number = std::strtod(start, &end);
+		if (end == start) return Fail("expected value");
+		position_ += end - start;
+		return true;
+	}
+	
+	// Parses any value. Objects nested at depth 2 are the benchmark entries.
+	bool ParseValue(int depth) {
+		SkipWhitespace();
+		if (position_ >= json_.size()) return Fail("unexpected end of input");
+		char c = json_[position_];
+		if (c == '{') return ParseObject(depth);
+		if (c == '[') return ParseArray(depth);
+		if (c == '"') {
+			std::string ignored;
+			return ParseString(ignored);
+		}
+		for (const char *literal : { "true", "false", "null" }) {
+			size_t length = std::char_traits<char>::length(literal);
+			if (json_.compare(position_, length, literal) == 0) {
+				position_ += length;
+				return true;
+			}
+		}
+		double ignored;
+		return ParseNumber(ignored);
+	}
+	
+	bool ParseArray(int depth) {
+		Consume('[');
+		if (Consume(']')) return true;
+		do {
+			if (!ParseValue(depth + 1)) return false;
+		} while (Consume(','));
+		return Consume(']') || Fail("expected ']'");
+	}
+	
+	bool ParseObject(int depth) {
+		Consume('{');
+		std::string name;
+		double median = NAN;
+		if (!Consume('}')) {
+			do {
+				std::string key;
+				if (!ParseString(key)) return false;
+				if (!Consume(':')) return Fail("expected ':'");
+				
+				SkipWhitespace();
+				if (depth == 2 && key == "name" && position_ < json_.size() && json_[position_] == '"') {
+					if (!ParseString(name)) return false;
+				} else if (depth == 2 && key == "median") {
+					if (!ParseNumber(median)) return false;
+				} else if (!ParseValue(depth + 1)) {
+					return false;
+				}
+			} while (Consume(','));
+			if (!Consume('}')) return Fail("expected '}'");
+		}
+		if (depth == 2 && !name.empty() && !std::isnan(median)) {
+			(*medians_)[name] = median;
+		}
+		return true;
+	}
+};
+
+} // namespace
+
+bool CompareWithBaseline(const std::vector<Result> &results, const std::string &baselineJSON, double threshold, std::vector<Comparison> &comparisons, std::string &error) {
+	std::map<std::string, double> baselineMedians;
+	if (!BaselineParser(baselineJSON).Parse(baselineMedians, error)) return false;
+	
+	for (const Result &result : results) {
+		auto baseline = baselineMedians.find(result.name);
+		if (baseline == baselineMedians.end() || baseline->second <= 0) continue;
+		
+		Comparison comparison;
+		comparison.name = result.name;
+		comparison.baselineMedian = baseline->second;
+		comparison.currentMedian = result.median;
+		comparison.change = result.median / baseline->second - 1;
+		comparison.regressed = comparison.change > threshold;
+		comparisons.push_back(comparison);
+	}
+	return true;
+}
+
+} // namespace benchmark
+} // namespace btr
@@ -0,0 +1,99 @@
+//
+//  BTRBenchmark.hpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#ifndef BTR_BENCHMARK_HPP
+#define BTR_BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace btr {
+namespace benchmark {
+
+// Runs the measured operation `iterations` times. Any setup that shouldn't be
+// measured belongs outside of the function, in the closure that registers it.
+typedef std::function<void(size_t iterations)> Function;
+
+struct Benchmark {
+	std::string name;
+	Function function;
+};
+
+// Adds a benchmark to the suite. Names are unique and sorted in the output.
+void Register(const std::string &name, Function function);
+const std::vector<Benchmark> &RegisteredBenchmarks();
+
+// Prevents the compiler from optimizing away a value that is otherwise unused.
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+	__asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+	static volatile const void *sink;
+	sink = &value;
+#endif
+}
+
+struct Options {
+	size_t repetitions = 10;
+	// The minimum duration of each repetition, used to choose the iteration count.
+	double minimumRepetitionTime = 0.05;
+	// Only benchmarks whose name contains the filter are run.
+	std::string filter;
+};
+
+struct Result {
+	std::string name;
+	size_t iterations = 0;
+	// Nanoseconds per iteration for each repetition, in the order they ran.
+	std::vector<double> samples;
+	
+	double mean = 0;
+	double standardDeviation = 0;
+	double minimum = 0;
+	double maximum = 0;
+	double median = 0;
+	double p90 = 0;
+	double p99 = 0;
+};
+
+std::vector<Result> Run(const Options &options);
+
+// Returns the value at `percentile` (0-100) of the samples, interpolating
+// linearly between the closest ranks.
+double Percentile(std::vector<double> samples, double percentile);
+
+std::string ResultsToJSON(const std::vector<Result> &results, const Options &options);
+
+struct Comparison {
+	std::string name;
+	double baselineMedian = 0;
+	double currentMedian = 0;
+	// The relative change of the median, e.g. 0.1 for 10% slower.
+	double change = 0;
+	bool regressed = false;
+};
+
+// Compares the medians of the results against a baseline written by
+// ResultsToJSON. Benchmarks missing from the baseline are skipped. Returns
+// false and sets `error` if the baseline can't be parsed.
+bool CompareWithBaseline(const std::vector<Result> &results, const std::string &baselineJSON, double threshold, std::vector<Comparison> &comparisons, std::string &error);
+
+} // namespace benchmark
+} // namespace btr
+
+#define BTR_BENCHMARK_CONCAT_(a, b) a ## b
+#define BTR_BENCHMARK_CONCAT(a, b) BTR_BENCHMARK_CONCAT_(a, b)
+
+// Registers a benchmark at static initialization time.
+#define BTR_BENCHMARK(name, ...) \
+	static const bool BTR_BENCHMARK_CONCAT(btrBenchmarkRegistered, __LINE__) = (::btr::benchmark::Register(name, __VA_ARGS__), true)
+
+#endif
@@ -0,0 +1,327 @@
+//
+//  BTRBenchmarkCases.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRBenchmark.hpp"
+#include "BTRGIFDecoder.h"
+#include "BTRGIFEncoder.hpp"
+#include "BTRNineSliceRasterizer.h"
+
+#include "BTRCoreControl.h"
+#include "BTRCoreFrameScheduler.h"
+#include "BTRCoreNineSlice.h"
+#include "BTRCoreScrollPhysics.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+using namespace btr::benchmark;
+
+namespace {
+
+// A small deterministic generator, so that every run benchmarks the same input.
+class Random {
+public:
+	explicit Random(uint32_t seed) : state_(seed) {}
+	uint32_t Next() {
+		state_ ^= state_ << 13;
+		state_ ^= state_ >> 17;
+		state_ ^= state_ << 5;
+		return state_;
+	}
+private:
+	uint32_t state_;
+};
+
+[[noreturn]] void Abort(const char *message) {
+	std::fprintf(stderr, "Benchmark setup failed: %s\n", message);
+	std::abort();
+}
+
+// Control state resolution
+
+BTR_BENCHMARK("control/state_resolution", [](size_t iterations) {
+	uint32_t states = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		// Cycles through every combination of flags.
+		states += BTRCoreControlStateResolve(i & 1, i & 2, i & 4, i & 8);
+	}
+	DoNotOptimize(states);
+});
+
+// Action dispatch
+
+struct ActionDispatchFixture {
+	BTRCoreActionList list;
+	size_t calls = 0;
+	
+	explicit ActionDispatchFixture(size_t actionCount) {
+		BTRCoreActionListInit(&list);
+		Random random(7);
+		for (size_t i = 0; i < actionCount; i++) {
+			// Actions mostly listen to a click or to mouse up and down.
+			uint32_t events = 1u << (3 + random.Next() % 4);
+			if (random.Next() % 4 == 0) events |= 1u << 12;
+			BTRCoreActionListAppend(&list, events);
+		}
+	}
+	~ActionDispatchFixture() {
+		BTRCoreActionListDestroy(&list);
+	}
+	
+	static void Perform(size_t index, uint32_t events, void *context) {
+		static_cast<ActionDispatchFixture *>(context)->calls += index + events;
+	}
+};
+
+BTR_BENCHMARK("control/action_dispatch", [](size_t iterations) {
+	static ActionDispatchFixture fixture(32);
+	for (size_t i = 0; i < iterations; i++) {
+		BTRCoreActionListDispatch(&fixture.list, 1u << 12 | 1u << 3, &ActionDispatchFixture::Perform, &fixture);
+	}
+	DoNotOptimize(fixture.calls);
+});
+
+// Continuous drag events that no action listens to take the early exit.
+BTR_BENCHMARK("control/action_dispatch_unobserved", [](size_t iterations) {
+	static ActionDispatchFixture fixture(32);
+	for (size_t i = 0; i < iterations; i++) {
+		BTRCoreActionListDispatch(&fixture.list, 1u << 1, &ActionDispatchFixture::Perform, &fixture);
+	}
+	DoNotOptimize(fixture.calls);
+});
+
+BTR_BENCHMARK("control/action_list_reuse", [](size_t iterations) {
+	BTRCoreActionList list;
+	BTRCoreActionListInit(&list);
+	for (size_t i = 0; i < iterations; i++) {
+		for (uint32_t j = 0; j < 8; j++) {
+			BTRCoreActionListAppend(&list, 1u << j);
+		}
+		BTRCoreActionListRemoveAll(&list);
+	}
+	BTRCoreActionListDestroy(&list);
+});
+
+// Nine-slice geometry and rasterization
+
+BTR_BENCHMARK("nine_slice/layout", [](size_t iterations) {
+	BTRCoreEdgeInsets insets = { 6, 12, 6, 12 };
+	BTRCoreRect sources[9], destinations[9];
+	double area = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		BTRCoreRect destination = { 0, 0, 20.0 + (i % 200), 24.0 + (i % 16) };
+		BTRCoreNineSliceLayout(32, 24, insets, destination, sources, destinations);
+		area += destinations[4].width * destinations[4].height;
+	}
+	DoNotOptimize(area);
+});
+
+BTR_BENCHMARK("nine_slice/contents_center", [](size_t iterations) {
+	BTRCoreEdgeInsets insets = { 6, 12, 6, 12 };
+	double sum = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		BTRCoreRect center = BTRCoreNineSliceContentsCenter(insets, 32.0 + (i % 8), 24);
+		sum += center.width;
+	}
+	DoNotOptimize(sum);
+});
+
+struct Bitmap {
+	std::vector<uint8_t> pixels;
+	size_t width;
+	size_t height;
+	
+	Bitmap(size_t width, size_t height) : pixels(width * height * 4), width(width), height(height) {}
+	
+	BTRBitmap Get() {
+		BTRBitmap bitmap = { pixels.data(), width, height, width * 4 };
+		return bitmap;
+	}
+};
+
+Bitmap NoiseBitmap(size_t width, size_t height) {
+	Bitmap bitmap(width, height);
+	Random random(3);
+	for (uint8_t &byte : bitmap.pixels) byte = (uint8_t)random.Next();
+	return bitmap;
+}
+
+// A 2x button background stretched to a typical button size.
+BTR_BENCHMARK("nine_slice/rasterize_button", [](size_t iterations) {
+	static Bitmap source = NoiseBitmap(64, 48);
+	static Bitmap destination(480, 56);
+	BTRBitmap sourceBitmap = source.Get(), destinationBitmap = destination.Get();
+	BTRCoreEdgeInsets insets = { 12, 24, 12, 24 };
+	for (size_t i = 0; i < iterations; i++) {
+		if (!BTRNineSliceRasterize(&sourceBitmap, insets, &destinationBitmap)) Abort("rasterization failed");
+	}
+	DoNotOptimize(destination.pixels[0]);
+});
+
+BTR_BENCHMARK("nine_slice/rasterize_panel", [](size_t iterations) {
+	static Bitmap source = NoiseBitmap(96, 96);
+	static Bitmap destination(1024, 768);
+	BTRBitmap sourceBitmap = source.Get(), destinationBitmap = destination.Get();
+	BTRCoreEdgeInsets insets = { 32, 32, 32, 32 };
+	for (size_t i = 0; i < iterations; i++) {
+		if (!BTRNineSliceRasterize(&sourceBitmap, insets, &destinationBitmap)) Abort("rasterization failed");
+	}
+	DoNotOptimize(destination.pixels[0]);
+});
+
+// GIF decode
+
+struct GIFFixture {
+	static const size_t width = 160;
+	static const size_t height = 120;
+	static const size_t frameCount = 12;
+	
+	std::vector<uint8_t> data;
+	std::vector<uint8_t> palette;
+	std::vector<GIFFrame> frames;
+	
+	GIFFixture() {
+		Random random(11);
+		for (size_t i = 0; i < 256 * 3; i++) palette.push_back((uint8_t)random.Next());
+		
+		for (size_t f = 0; f < frameCount; f++) {
+			GIFFrame frame;
+			if (f == 0) {
+				frame.width = width;
+				frame.height = height;
+			} else {
+				// Later frames only update a moving region, with a transparent
+				// background, like most animations.
+				frame.x = (f * 9) % (width / 2);
+				frame.y = (f * 5) % (height / 2);
+				frame.width = width / 2;
+				frame.height = height / 2;
+				frame.transparentIndex = 0;
+			}
+			frame.interlaced = (f % 3 == 1);
+			frame.indices.resize(frame.width * frame.height);
+			for (size_t y = 0; y < frame.height; y++) {
+				for (size_t x = 0; x < frame.width; x++) {
+					// Bands of color with some noise compress like real content.
+					uint8_t index = (uint8_t)(((x + f * 3) / 6 + y / 4) % 64 + 1);
+					if (random.Next() % 16 == 0) index = (uint8_t)(random.Next() % 256);
+					if (f > 0 && (x + y) % 5 == 0) index = 0;
+					frame.indices[y * frame.width + x] = index;
+				}
+			}
+			frames.push_back(frame);
+		}
+		data = EncodeGIF(width, height, palette, frames, 0);
+		Verify();
+	}
+	
+	// Checks the decoder against the frames composed here, so that a broken
+	// decoder can't produce misleadingly fast results.
+	void Verify() {
+		BTRGIFDecoder *decoder = BTRGIFDecoderCreate(data.data(), data.size());
+		if (decoder == nullptr) Abort("GIF could not be parsed");
+		if (BTRGIFDecoderGetFrameCount(decoder) != frameCount) Abort("wrong GIF frame count");
+		if (BTRGIFDecoderGetLoopCount(decoder) != 0) Abort("wrong GIF loop count");
+		
+		std::vector<uint8_t> canvas(width * height * 4, 0);
+		for (size_t f = 0; f < frameCount; f++) {
+			const GIFFrame &frame = frames[f];
+			for (size_t y = 0; y < frame.height; y++) {
+				for (size_t x = 0; x < frame.width; x++) {
+					uint8_t index = frame.indices[y * frame.width + x];
+					if ((int)index == frame.transparentIndex) continue;
+					uint8_t *pixel = &canvas[((frame.y + y) * width + frame.x + x) * 4];
+					std::memcpy(pixel, &palette[index * 3], 3);
+					pixel[3] = 0xFF;
+				}
+			}
+			const uint8_t *decoded = BTRGIFDecoderDecodeFrame(decoder, f);
+			if (decoded == nullptr || std::memcmp(decoded, canvas.data(), canvas.size()) != 0) Abort("decoded GIF frame doesn't match");
+		}
+		BTRGIFDecoderDestroy(decoder);
+	}
+};
+
+GIFFixture &SharedGIFFixture() {
+	static GIFFixture fixture;
+	return fixture;
+}
+
+BTR_BENCHMARK("gif/parse", [](size_t iterations) {
+	const GIFFixture &fixture = SharedGIFFixture();
+	for (size_t i = 0; i < iterations; i++) {
+		BTRGIFDecoder *decoder = BTRGIFDecoderCreate(fixture.data.data(), fixture.data.size());
+		DoNotOptimize(decoder);
+		BTRGIFDecoderDestroy(decoder);
+	}
+});
+
+// Plays the whole animation once per iteration.
+BTR_BENCHMARK("gif/decode_all_frames", [](size_t iterations) {
+	const GIFFixture &fixture = SharedGIFFixture();
+	std::unique_ptr<BTRGIFDecoder, void (*)(BTRGIFDecoder *)> decoder(BTRGIFDecoderCreate(fixture.data.data(), fixture.data.size()), &BTRGIFDecoderDestroy);
+	for (size_t i = 0; i < iterations; i++) {
+		for (size_t f = 0; f < GIFFixture::frameCount; f++) {
+			DoNotOptimize(BTRGIFDecoderDecodeFrame(decoder.get(), f));
+		}
+	}
+});
+
+// Scroll physics
+
+// A full animated scroll of a long document, until the origin settles.
+BTR_BENCHMARK("clip_view/scroll_animation", [](size_t iterations) {
+	size_t frames = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		BTRCorePoint origin = { 0, 0 };
+		BTRCorePoint destination = { 0, 12000.0 + (i % 7) * 100 };
+		while (!BTRCoreScrollStep(&origin, destination, 0.78)) frames++;
+	}
+	DoNotOptimize(frames);
+});
+
+// Animation frame scheduler
+
+struct SchedulerFixture {
+	size_t calls = 0;
+	static void Callback(double timestamp, void *context) {
+		static_cast<SchedulerFixture *>(context)->calls += (timestamp > 0);
+	}
+};
+
+// A frame with as many callbacks as a busy window would schedule.
+BTR_BENCHMARK("frame_scheduler/frame", [](size_t iterations) {
+	SchedulerFixture fixture;
+	BTRCoreFrameScheduler *scheduler = BTRCoreFrameSchedulerCreate();
+	for (size_t i = 0; i < iterations; i++) {
+		for (int j = 0; j < 64; j++) {
+			BTRCoreFrameSchedulerSchedule(scheduler, &SchedulerFixture::Callback, &fixture, nullptr);
+		}
+		if (BTRCoreFrameSchedulerBeginFrame(scheduler)) {
+			BTRCoreFrameSchedulerFire(scheduler, 1.0 + i / 60.0);
+		}
+	}
+	BTRCoreFrameSchedulerDestroy(scheduler);
+	DoNotOptimize(fixture.calls);
+});
+
+// Display link ticks arriving while the previous frame hasn't been fired yet.
+BTR_BENCHMARK("frame_scheduler/skipped_tick", [](size_t iterations) {
+	BTRCoreFrameScheduler *scheduler = BTRCoreFrameSchedulerCreate();
+	BTRCoreFrameSchedulerBeginFrame(scheduler);
+	size_t skipped = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		skipped += !BTRCoreFrameSchedulerBeginFrame(scheduler);
+	}
+	BTRCoreFrameSchedulerDestroy(scheduler);
+	DoNotOptimize(skipped);
+});
+
+} // namespace
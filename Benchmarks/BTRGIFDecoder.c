@@ -0,0 +1,410 @@
+//
+//  BTRGIFDecoder.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRGIFDecoder.h"
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+	BTRGIFDisposalNone = 0,
+	BTRGIFDisposalKeep = 1,
+	BTRGIFDisposalBackground = 2,
+	BTRGIFDisposalPrevious = 3
+};
+
+typedef struct {
+	size_t x, y, width, height;
+	bool interlaced;
+	const uint8_t *palette;
+	size_t paletteCount;
+	int transparentIndex;
+	int disposal;
+	unsigned delay;
+	// Offset of the LZW minimum code size that starts the image data.
+	size_t dataOffset;
+} BTRGIFFrame;
+
+struct BTRGIFDecoder {
+	const uint8_t *data;
+	size_t length;
+	size_t width;
+	size_t height;
+	size_t loopCount;
+	
+	BTRGIFFrame *frames;
+	size_t frameCount;
+	
+	uint8_t *canvas;
+	// The canvas before the last frame was drawn, for frames disposed by
+	// restoring the previous contents.
+	uint8_t *previousCanvas;
+	uint8_t *indices;
+	// The last frame drawn onto the canvas, or -1.
+	long lastFrame;
+};
+
+static uint16_t BTRGIFReadUInt16(const uint8_t *bytes) {
+	return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+// Returns the offset after a sequence of data sub-blocks, or 0 if it is truncated.
+static size_t BTRGIFSkipSubBlocks(const uint8_t *data, size_t length, size_t offset) {
+	while (offset < length) {
+		size_t size = data[offset++];
+		if (size == 0) return offset;
+		offset += size;
+	}
+	return 0;
+}
+
+static bool BTRGIFAppendFrame(BTRGIFDecoder *decoder, BTRGIFFrame frame, size_t *capacity) {
+	if (decoder->frameCount == *capacity) {
+		size_t newCapacity = (*capacity > 0 ? *capacity * 2 : 8);
+		BTRGIFFrame *frames = realloc(decoder->frames, newCapacity * sizeof(BTRGIFFrame));
+		if (frames == NULL) return false;
+		decoder->frames = frames;
+		*capacity = newCapacity;
+	}
+	decoder->frames[decoder->frameCount++] = frame;
+	return true;
+}
+
+static bool BTRGIFParse(BTRGIFDecoder *decoder) {
+	const uint8_t *data = decoder->data;
+	size_t length = decoder->length;
+	if (length < 13 || memcmp(data, "GIF8", 4) != 0 || (data[4] != '7' && data[4] != '9') || data[5] != 'a') return false;
+	
+	decoder->width = BTRGIFReadUInt16(data + 6);
+	decoder->height = BTRGIFReadUInt16(data + 8);
+	decoder->loopCount = 1;
+	if (decoder->width == 0 || decoder->height == 0) return false;
+	
+	uint8_t screenFlags = data[10];
+	size_t offset = 13;
+	const uint8_t *globalPalette = NULL;
+	size_t globalPaletteCount = 0;
+	if (screenFlags & 0x80) {
+		globalPaletteCount = (size_t)1 << ((screenFlags & 0x07) + 1);
+		globalPalette = data + offset;
+		offset += globalPaletteCount * 3;
+		if (offset > length) return false;
+	}
+	
+	// Graphic control extensions apply to the next image.
+	int transparentIndex = -1;
+	int disposal = BTRGIFDisposalNone;
+	unsigned delay = 0;
+	size_t capacity = 0;
+	
+	while (offset < length) {
+		uint8_t introducer = data[offset++];
+		if (introducer == 0x3B) {
+			break;
+		} else if (introducer == 0x21) {
+			if (offset >= length) return false;
+			uint8_t label = data[offset++];
+			if (label == 0xF9 && offset + 5 < length && data[offset] == 4) {
+				uint8_t flags = data[offset + 1];
+				disposal = (flags >> 2) & 0x07;
+				delay = BTRGIFReadUInt16(data + offset + 2);
+				transparentIndex = (flags & 0x01) ? data[offset + 4] : -1;
+			} else if (label == 0xFF && offset + 16 < length && data[offset] == 11 && memcmp(data + offset + 1, "NETSCAPE2.0", 11) == 0 && data[offset + 12] == 3 && data[offset + 13] == 1) {
+				decoder->loopCount = BTRGIFReadUInt16(data + offset + 14);
+			}
+			offset = BTRGIFSkipSubBlocks(data, length, offset);
+			if (offset == 0) return false;
+		} else if (introducer == 0x2C) {
+			if (offset + 9 > length) return false;
+			BTRGIFFrame frame;
+			frame.x = BTRGIFReadUInt16(data + offset);
+			frame.y = BTRGIFReadUInt16(data + offset + 2);
+			frame.width = BTRGIFReadUInt16(data + offset + 4);
+			frame.height = BTRGIFReadUInt16(data + offset + 6);
+			uint8_t imageFlags = data[offset + 8];
+			offset += 9;
+			
+			frame.interlaced = (imageFlags & 0x40) != 0;
+			frame.palette = globalPalette;
+			frame.paletteCount = globalPaletteCount;
+			if (imageFlags & 0x80) {
+				frame.paletteCount = (size_t)1 << ((imageFlags & 0x07) + 1);
+				frame.palette = data + offset;
+				offset += frame.paletteCount * 3;
+				if (offset > length) return false;
+			}
+			frame.transparentIndex = transparentIndex;
+			frame.disposal = disposal;
+			frame.delay = delay;
+			frame.dataOffset = offset;
+			
+			if (offset >= length) return false;
+			offset = BTRGIFSkipSubBlocks(data, length, offset + 1);
+			if (offset == 0) return false;
+			if (!BTRGIFAppendFrame(decoder, frame, &capacity)) return false;
+			
+			transparentIndex = -1;
+			disposal = BTRGIFDisposalNone;
+			delay = 0;
+		} else {
+			return false;
+		}
+	}
+	
+	return decoder->frameCount > 0;
+}
+
+BTRGIFDecoder *BTRGIFDecoderCreate(const uint8_t *data, size_t length) {
+	if (data == NULL) return NULL;
+	
+	BTRGIFDecoder *decoder = calloc(1, sizeof(BTRGIFDecoder));
+	if (decoder == NULL) return NULL;
+	decoder->data = data;
+	decoder->length = length;
+	decoder->lastFrame = -1;
+	
+	if (!BTRGIFParse(decoder)) {
+		BTRGIFDecoderDestroy(decoder);
+		return NULL;
+	}
+	
+	size_t canvasSize = decoder->width * decoder->height * 4;
+	decoder->canvas = calloc(canvasSize, 1);
+	decoder->previousCanvas = malloc(canvasSize);
+	decoder->indices = malloc(decoder->width * decoder->height);
+	if (decoder->canvas == NULL || decoder->previousCanvas == NULL || decoder->indices == NULL) {
+		BTRGIFDecoderDestroy(decoder);
+		return NULL;
+	}
+	return decoder;
+}
+
+void BTRGIFDecoderDestroy(BTRGIFDecoder *decoder) {
+	if (decoder == NULL) return;
+	free(decoder->frames);
+	free(decoder->canvas);
+	free(decoder->previousCanvas);
+	free(decoder->indices);
+	free(decoder);
+}
+
+size_t BTRGIFDecoderGetWidth(const BTRGIFDecoder *decoder) {
+	return decoder->width;
+}
+
+size_t BTRGIFDecoderGetHeight(const BTRGIFDecoder *decoder) {
+	return decoder->height;
+}
+
+size_t BTRGIFDecoderGetFrameCount(const BTRGIFDecoder *decoder) {
+	return decoder->frameCount;
+}
+
+size_t BTRGIFDecoderGetLoopCount(const BTRGIFDecoder *decoder) {
+	return decoder->loopCount;
+}
+
+double BTRGIFDecoderGetFrameDuration(const BTRGIFDecoder *decoder, size_t index) {
+	if (index >= decoder->frameCount) return 0;
+	unsigned delay = decoder->frames[index].delay;
+	return (delay <= 1 ? 0.1 : delay / 100.0);
+}
+
+// Decoding
+
+// Decompresses the LZW image data of a frame into palette indices. Pixels
+// missing from truncated data are left as index 0.
+static bool BTRGIFDecompress(const uint8_t *data, size_t length, size_t offset, uint8_t *indices, size_t pixelCount) {
+	memset(indices, 0, pixelCount);
+	
+	unsigned minimumCodeSize = data[offset++];
+	if (minimumCodeSize < 2 || minimumCodeSize > 11) return false;
+	
+	uint16_t prefix[4096];
+	uint8_t suffix[4096];
+	uint8_t stack[4097];
+	
+	const unsigned clearCode = 1u << minimumCodeSize;
+	const unsigned endCode = clearCode + 1;
+	for (unsigned code = 0; code < clearCode; code++) {
+		prefix[code] = 0;
+		suffix[code] = (uint8_t)code;
+	}
+	
+	unsigned codeSize = minimumCodeSize + 1;
+	unsigned nextCode = clearCode + 2;
+	int previousCode = -1;
+	uint8_t firstByte = 0;
+	
+	uint32_t bits = 0;
+	unsigned bitCount = 0;
+	size_t blockRemaining = 0;
+	size_t written = 0;
+	
+	while (written < pixelCount) {
+		while (bitCount < codeSize) {
+			if (blockRemaining == 0) {
+				if (offset >= length) return true;
+				blockRemaining = data[offset++];
+				if (blockRemaining == 0) return true;
+			}
+			if (offset >= length) return true;
+			bits |= (uint32_t)data[offset++] << bitCount;
+			bitCount += 8;
+			blockRemaining--;
+		}
+		
+		unsigned code = bits & ((1u << codeSize) - 1);
+		bits >>= codeSize;
+		bitCount -= codeSize;
+		
+		if (code == clearCode) {
+			codeSize = minimumCodeSize + 1;
+			nextCode = clearCode + 2;
+			previousCode = -1;
+			continue;
+		}
+		if (code == endCode) break;
+		
+		if (previousCode < 0) {
+			if (code >= clearCode) return false;
+			firstByte = (uint8_t)code;
+			indices[written++] = firstByte;
+			previousCode = (int)code;
+			continue;
+		}
+		
+		unsigned currentCode = code;
+		size_t stackSize = 0;
+		if (code >= nextCode) {
+			if (code > nextCode) return false;
+			stack[stackSize++] = firstByte;
+			code = (unsigned)previousCode;
+		}
+		while (code >= clearCode) {
+			stack[stackSize++] = suffix[code];
+			code = prefix[code];
+		}
+		firstByte = suffix[code];
+		stack[stackSize++] = firstByte;
+		
+		while (stackSize > 0 && written < pixelCount) {
+			indices[written++] = stack[--stackSize];
+		}
+		
+		if (nextCode < 4096) {
+			prefix[nextCode] = (uint16_t)previousCode;
+			suffix[nextCode] = firstByte;
+			nextCode++;
+			if (nextCode == (1u << codeSize) && codeSize < 12) codeSize++;
+		}
+		previousCode = (int)currentCode;
+	}
+	
+	return true;
+}
+
+static void BTRGIFClearRect(BTRGIFDecoder *decoder, const BTRGIFFrame *frame) {
+	if (frame->x >= decoder->width || frame->y >= decoder->height) return;
+	size_t width = frame->width < decoder->width - frame->x ? frame->width : decoder->width - frame->x;
+	size_t height = frame->height < decoder->height - frame->y ? frame->height : decoder->height - frame->y;
+	for (size_t y = 0; y < height; y++) {
+		memset(decoder->canvas + ((frame->y + y) * decoder->width + frame->x) * 4, 0, width * 4);
+	}
+}
+
+static bool BTRGIFDrawFrame(BTRGIFDecoder *decoder, size_t index) {
+	const BTRGIFFrame *frame = &decoder->frames[index];
+	size_t canvasSize = decoder->width * decoder->height * 4;
+	
+	// Undo the previous frame according to its disposal method.
+	if (index == 0) {
+		memset(decoder->canvas, 0, canvasSize);
+	} else {
+		const BTRGIFFrame *previous = &decoder->frames[index - 1];
+		if (previous->disposal == BTRGIFDisposalBackground) {
+			BTRGIFClearRect(decoder, previous);
+		} else if (previous->disposal == BTRGIFDisposalPrevious) {
+			memcpy(decoder->canvas, decoder->previousCanvas, canvasSize);
+		}
+	}
+	if (frame->disposal == BTRGIFDisposalPrevious) {
+		memcpy(decoder->previousCanvas, decoder->canvas, canvasSize);
+	}
+	
+	size_t pixelCount = frame->width * frame->height;
+	if (pixelCount == 0) return true;
+	
+	uint8_t *indices = decoder->indices;
+	uint8_t *frameIndices = NULL;
+	if (pixelCount > decoder->width * decoder->height) {
+		// Frames larger than the logical screen are clipped, but still have to
+		// be decompressed in full.
+		frameIndices = malloc(pixelCount);
+		if (frameIndices == NULL) return false;
+		indices = frameIndices;
+	}
+	if (!BTRGIFDecompress(decoder->data, decoder->length, frame->dataOffset, indices, pixelCount)) {
+		free(frameIndices);
+		return false;
+	}
+	
+	static const size_t passStart[4] = { 0, 4, 2, 1 };
+	static const size_t passStep[4] = { 8, 8, 4, 2 };
+	size_t pass = 0;
+	size_t row = 0;
+	
+	for (size_t i = 0; i < frame->height; i++) {
+		size_t y = i;
+		if (frame->interlaced) {
+			while (pass < 3 && row >= frame->height) {
+				pass++;
+				row = passStart[pass];
+			}
+			y = row;
+			row += passStep[pass];
+		}
+		
+		size_t canvasY = frame->y + y;
+		if (canvasY >= decoder->height) continue;
+		
+		const uint8_t *sourceRow = indices + i * frame->width;
+		uint8_t *canvasRow = decoder->canvas + canvasY * decoder->width * 4;
+		for (size_t x = 0; x < frame->width; x++) {
+			size_t canvasX = frame->x + x;
+			if (canvasX >= decoder->width) break;
+			
+			uint8_t colorIndex = sourceRow[x];
+			if ((int)colorIndex == frame->transparentIndex || colorIndex >= frame->paletteCount) continue;
+			
+			const uint8_t *color = frame->palette + colorIndex * 3;
+			uint8_t *pixel = canvasRow + canvasX * 4;
+			pixel[0] = color[0];
+			pixel[1] = color[1];
+			pixel[2] = color[2];
+			pixel[3] = 0xFF;
+		}
+	}
+	
+	free(frameIndices);
+	return true;
+}
+
+const uint8_t *BTRGIFDecoderDecodeFrame(BTRGIFDecoder *decoder, size_t index) {
+	if (index >= decoder->frameCount) return NULL;
+	if ((long)index == decoder->lastFrame) return decoder->canvas;
+	
+	size_t first = (decoder->lastFrame >= 0 && (size_t)decoder->lastFrame < index) ? (size_t)decoder->lastFrame + 1 : 0;
+	for (size_t i = first; i <= index; i++) {
+		if (!BTRGIFDrawFrame(decoder, i)) {
+			decoder->lastFrame = -1;
+			return NULL;
+		}
+		decoder->lastFrame = (long)i;
+	}
+	return decoder->canvas;
+}
@@ -0,0 +1,56 @@
+//
+//  BTRGIFDecoder.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// A portable decoder for animated GIFs, composing each frame onto the logical
+// screen the way BTRImageView displays them. BTRImageView itself decodes
+// through NSBitmapImageRep; this is the benchmarks' model of that workload.
+
+#ifndef BTR_GIF_DECODER_H
+#define BTR_GIF_DECODER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BTRGIFDecoder BTRGIFDecoder;
+
+// Parses the structure of a GIF without decoding any frames. The data must
+// remain valid for the lifetime of the decoder. Returns NULL if the data is not
+// a GIF or if it doesn't contain any frames.
+BTRGIFDecoder *BTRGIFDecoderCreate(const uint8_t *data, size_t length);
+void BTRGIFDecoderDestroy(BTRGIFDecoder *decoder);
+
+size_t BTRGIFDecoderGetWidth(const BTRGIFDecoder *decoder);
+size_t BTRGIFDecoderGetHeight(const BTRGIFDecoder *decoder);
+size_t BTRGIFDecoderGetFrameCount(const BTRGIFDecoder *decoder);
+
+// The number of times the animation plays, where 0 means forever. Images
+// without a looping extension play once.
+size_t BTRGIFDecoderGetLoopCount(const BTRGIFDecoder *decoder);
+
+// The duration of the frame in seconds. Delays of 10ms or less are treated as
+// 100ms, matching other decoders.
+double BTRGIFDecoderGetFrameDuration(const BTRGIFDecoder *decoder, size_t index);
+
+// Decodes the frame and composes it over the frames before it. Returns the
+// composed image as premultiplied RGBA rows of `width * 4` bytes, which remain
+// valid until the next call, or NULL if the frame data is corrupt.
+//
+// Decoding the last decoded frame or the one after it is incremental; any
+// other frame is composed again from the first frame.
+const uint8_t *BTRGIFDecoderDecodeFrame(BTRGIFDecoder *decoder, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,158 @@
+//
+//  BTRGIFEncoder.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRGIFEncoder.hpp"
+
+#include <unordered_map>
+
+namespace btr {
+namespace benchmark {
+
+namespace {
+
+void AppendUInt16(std::vector<uint8_t> &data, unsigned value) {
+	data.push_back((uint8_t)(value & 0xFF));
+	data.push_back((uint8_t)((value >> 8) & 0xFF));
+}
+
+// Packs variable-width codes least significant bit first, and splits the
+// output into data sub-blocks.
+class CodeWriter {
+public:
+	explicit CodeWriter(std::vector<uint8_t> &data) : data_(data), bits_(0), bitCount_(0) {}
+	
+	void Write(unsigned code, unsigned size) {
+		bits_ |= (uint32_t)code << bitCount_;
+		bitCount_ += size;
+		while (bitCount_ >= 8) {
+			bytes_.push_back((uint8_t)(bits_ & 0xFF));
+			bits_ >>= 8;
+			bitCount_ -= 8;
+		}
+	}
+	
+	void Finish() {
+		if (bitCount_ > 0) bytes_.push_back((uint8_t)(bits_ & 0xFF));
+		for (size_t offset = 0; offset < bytes_.size(); offset += 255) {
+			size_t size = std::min((size_t)255, bytes_.size() - offset);
+			data_.push_back((uint8_t)size);
+			data_.insert(data_.end(), bytes_.begin() + offset, bytes_.begin() + offset + size);
+		}
+		data_.push_back(0);
+	}
+	
+private:
+	std::vector<uint8_t> &data_;
+	std::vector<uint8_t> bytes_;
+	uint32_t bits_;
+	unsigned bitCount_;
+};
+
+void CompressLZW(std::vector<uint8_t> &data, const std::vector<uint8_t> &indices) {
+	const unsigned minimumCodeSize = 8;
+	const unsigned clearCode = 1u << minimumCodeSize;
+	const unsigned endCode = clearCode + 1;
+	data.push_back((uint8_t)minimumCodeSize);
+	
+	CodeWriter writer(data);
+	std::unordered_map<uint32_t, unsigned> table;
+	unsigned codeSize = minimumCodeSize + 1;
+	unsigned nextCode = clearCode + 2;
+	writer.Write(clearCode, codeSize);
+	
+	if (indices.empty()) {
+		writer.Write(endCode, codeSize);
+		writer.Finish();
+		return;
+	}
+	
+	unsigned prefix = indices[0];
+	for (size_t i = 1; i < indices.size(); i++) {
+		uint32_t key = (prefix << 8) | indices[i];
+		auto entry = table.find(key);
+		if (entry != table.end()) {
+			prefix = entry->second;
+			continue;
+		}
+		
+		writer.Write(prefix, codeSize);
+		table[key] = nextCode++;
+		// The decoder adds its entries one code behind, so the width grows
+		// once the next code no longer fits.
+		if (nextCode > (1u << codeSize) && codeSize < 12) codeSize++;
+		if (nextCode == 4096) {
+			writer.Write(clearCode, codeSize);
+			table.clear();
+			codeSize = minimumCodeSize + 1;
+			nextCode = clearCode + 2;
+		}
+		prefix = indices[i];
+	}
+	
+	writer.Write(prefix, codeSize);
+	// Matches the entry the decoder adds for the last code.
+	if (nextCode != clearCode + 2 && nextCode == (1u << codeSize) && codeSize < 12) codeSize++;
+	writer.Write(endCode, codeSize);
+	writer.Finish();
+}
+
+std::vector<uint8_t> Interlace(const GIFFrame &frame) {
+	static const size_t passStart[4] = { 0, 4, 2, 1 };
+	static const size_t passStep[4] = { 8, 8, 4, 2 };
+	std::vector<uint8_t> indices;
+	indices.reserve(frame.indices.size());
+	for (int pass = 0; pass < 4; pass++) {
+		for (size_t y = passStart[pass]; y < frame.height; y += passStep[pass]) {
+			indices.insert(indices.end(), frame.indices.begin() + y * frame.width, frame.indices.begin() + (y + 1) * frame.width);
+		}
+	}
+	return indices;
+}
+
+} // namespace
+
+std::vector<uint8_t> EncodeGIF(size_t width, size_t height, const std::vector<uint8_t> &palette, const std::vector<GIFFrame> &frames, unsigned loopCount) {
+	std::vector<uint8_t> data = { 'G', 'I', 'F', '8', '9', 'a' };
+	AppendUInt16(data, (unsigned)width);
+	AppendUInt16(data, (unsigned)height);
+	data.push_back(0xF7); // 256 color global palette
+	data.push_back(0);
+	data.push_back(0);
+	for (size_t i = 0; i < 256 * 3; i++) {
+		data.push_back(i < palette.size() ? palette[i] : 0);
+	}
+	
+	const char *application = "NETSCAPE2.0";
+	data.insert(data.end(), { 0x21, 0xFF, 11 });
+	data.insert(data.end(), application, application + 11);
+	data.insert(data.end(), { 3, 1 });
+	AppendUInt16(data, loopCount);
+	data.push_back(0);
+	
+	for (const GIFFrame &frame : frames) {
+		data.insert(data.end(), { 0x21, 0xF9, 4 });
+		data.push_back(frame.transparentIndex >= 0 ? 0x05 : 0x04); // keep the frame in place
+		AppendUInt16(data, frame.delay);
+		data.push_back((uint8_t)(frame.transparentIndex >= 0 ? frame.transparentIndex : 0));
+		data.push_back(0);
+		
+		data.push_back(0x2C);
+		AppendUInt16(data, (unsigned)frame.x);
+		AppendUInt16(data, (unsigned)frame.y);
+		AppendUInt16(data, (unsigned)frame.width);
+		AppendUInt16(data, (unsigned)frame.height);
+		data.push_back(frame.interlaced ? 0x40 : 0x00);
+		CompressLZW(data, frame.interlaced ? Interlace(frame) : frame.indices);
+	}
+	
+	data.push_back(0x3B);
+	return data;
+}
+
+} // namespace benchmark
+} // namespace btr
@@ -0,0 +1,35 @@
+//
+//  BTRGIFEncoder.hpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#ifndef BTR_GIF_ENCODER_HPP
+#define BTR_GIF_ENCODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace btr {
+namespace benchmark {
+
+struct GIFFrame {
+	size_t x = 0, y = 0, width = 0, height = 0;
+	// One palette index per pixel, row by row.
+	std::vector<uint8_t> indices;
+	bool interlaced = false;
+	int transparentIndex = -1;
+	unsigned delay = 10;
+};
+
+// Encodes an animated GIF with a 256 color global palette, used to generate the
+// input of the decode benchmarks without shipping image files.
+std::vector<uint8_t> EncodeGIF(size_t width, size_t height, const std::vector<uint8_t> &palette, const std::vector<GIFFrame> &frames, unsigned loopCount);
+
+} // namespace benchmark
+} // namespace btr
+
+#endif
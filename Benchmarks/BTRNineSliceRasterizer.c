@@ -0,0 +1,66 @@
+//
+//  BTRNineSliceRasterizer.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRNineSliceRasterizer.h"
+#include "BTRCoreNineSlice.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Maps every destination pixel along one axis to the source pixel it samples.
+static void BTRNineSliceBuildMap(size_t sourceLength, size_t destinationLength, double leadingCap, double trailingCap, size_t *map) {
+	double src[4], dst[4];
+	BTRCoreNineSliceSegments((double)sourceLength, round(leadingCap), round(trailingCap), src);
+	BTRCoreNineSliceSegments((double)destinationLength, round(leadingCap), round(trailingCap), dst);
+	
+	int segment = 0;
+	for (size_t i = 0; i < destinationLength; i++) {
+		double position = (double)i + 0.5;
+		while (segment < 2 && position >= dst[segment + 1]) segment++;
+		
+		double dstLength = dst[segment + 1] - dst[segment];
+		double srcLength = src[segment + 1] - src[segment];
+		double sample = src[segment];
+		if (dstLength > 0) sample += (position - dst[segment]) * srcLength / dstLength;
+		
+		size_t index = (size_t)sample;
+		map[i] = (index < sourceLength ? index : sourceLength - 1);
+	}
+}
+
+bool BTRNineSliceRasterize(const BTRBitmap *source, BTRCoreEdgeInsets insets, BTRBitmap *destination) {
+	if (source->width == 0 || source->height == 0 || destination->width == 0 || destination->height == 0) return false;
+	
+	size_t *xMap = malloc(destination->width * sizeof(size_t));
+	size_t *yMap = malloc(destination->height * sizeof(size_t));
+	if (xMap == NULL || yMap == NULL) {
+		free(xMap);
+		free(yMap);
+		return false;
+	}
+	BTRNineSliceBuildMap(source->width, destination->width, insets.left, insets.right, xMap);
+	BTRNineSliceBuildMap(source->height, destination->height, insets.top, insets.bottom, yMap);
+	
+	for (size_t y = 0; y < destination->height; y++) {
+		const uint8_t *sourceRow = source->data + yMap[y] * source->bytesPerRow;
+		uint8_t *destinationRow = destination->data + y * destination->bytesPerRow;
+		
+		// Rows sampling the same source row as the previous one are copied whole.
+		if (y > 0 && yMap[y] == yMap[y - 1]) {
+			memcpy(destinationRow, destinationRow - destination->bytesPerRow, destination->width * 4);
+			continue;
+		}
+		for (size_t x = 0; x < destination->width; x++) {
+			memcpy(destinationRow + x * 4, sourceRow + xMap[x] * 4, 4);
+		}
+	}
+	
+	free(xMap);
+	free(yMap);
+	return true;
+}
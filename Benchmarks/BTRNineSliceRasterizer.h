@@ -0,0 +1,43 @@
+//
+//  BTRNineSliceRasterizer.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// A software model of the stretching Core Animation performs for a layer's
+// contentsCenter, used by the benchmarks to weigh the cost of nine-slice
+// scaling against the geometry Butter computes for it.
+
+#ifndef BTR_NINE_SLICE_RASTERIZER_H
+#define BTR_NINE_SLICE_RASTERIZER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "BTRCoreGeometry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A premultiplied RGBA bitmap with 8 bits per component and rows ordered from
+// the top.
+typedef struct {
+	uint8_t *data;
+	size_t width;
+	size_t height;
+	size_t bytesPerRow;
+} BTRBitmap;
+
+// Fills the whole destination bitmap by stretching the source's slices with
+// nearest-neighbor sampling. The insets are in pixels. Returns false if either
+// bitmap is empty.
+bool BTRNineSliceRasterize(const BTRBitmap *source, BTRCoreEdgeInsets insets, BTRBitmap *destination);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+//
+//  main.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRBenchmark.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace btr::benchmark;
+
+static void PrintUsage(const char *program) {
+	std::printf(
+		"usage: %s [options]\n"
+		"\n"
+		"  --filter <substring>     only run benchmarks whose name contains the substring\n"
+		"  --repetitions <n>        repetitions per benchmark (default 10)\n"
+		"  --min-time <seconds>     minimum duration of each repetition (default 0.05)\n"
+		"  --output <path>          write the results as JSON\n"
+		"  --baseline <path>        compare the medians against a previous JSON output\n"
+		"  --threshold <fraction>   slowdown that counts as a regression (default 0.10)\n"
+		"  --list                   list the benchmarks and exit\n"
+		"\n"
+		"Exits with status 1 if a benchmark regressed against the baseline.\n",
+		program);
+}
+
+static bool ReadFile(const std::string &path, std::string &contents) {
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	if (!file) return false;
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	contents = stream.str();
+	return true;
+}
+
+int main(int argc, char **argv) {
+	Options options;
+	std::string outputPath, baselinePath;
+	double threshold = 0.10;
+	
+	for (int i = 1; i < argc; i++) {
+		const char *argument = argv[i];
+		const char *value = (i + 1 < argc ? argv[i + 1] : nullptr);
+		
+		if (std::strcmp(argument, "--filter") == 0 && value) {
+			options.filter = value;
+		} else if (std::strcmp(argument, "--repetitions") == 0 && value) {
+			options.repetitions = (size_t)std::strtoul(value, nullptr, 10);
+		} else if (std::strcmp(argument, "--min-time") == 0 && value) {
+			options.minimumRepetitionTime = std::strtod(value, nullptr);
+		} else if (std::strcmp(argument, "--output") == 0 && value) {
+			outputPath = value;
+		} else if (std::strcmp(argument, "--baseline") == 0 && value) {
+			baselinePath = value;
+		} else if (std::strcmp(argument, "--threshold") == 0 && value) {
+			threshold = std::strtod(value, nullptr);
+		} else if (std::strcmp(argument, "--list") == 0) {
+			for (const Benchmark &benchmark : RegisteredBenchmarks()) std::printf("%s\n", benchmark.name.c_str());
+			return 0;
+		} else {
+			PrintUsage(argv[0]);
+			return (std::strcmp(argument, "--help") == 0 ? 0 : 2);
+		}
+		i++;
+	}
+	if (options.repetitions == 0 || options.minimumRepetitionTime <= 0 || threshold < 0) {
+		std::fprintf(stderr, "Invalid option value\n");
+		return 2;
+	}
+	
+	std::string baselineJSON;
+	if (!baselinePath.empty() && !ReadFile(baselinePath, baselineJSON)) {
+		std::fprintf(stderr, "Could not read baseline %s\n", baselinePath.c_str());
+		return 2;
+	}
+	
+	std::vector<Result> results = Run(options);
+	std::printf("%-40s %12s %12s %12s %12s\n", "benchmark", "median ns", "p90 ns", "p99 ns", "stddev");
+	for (const Result &result : results) {
+		std::printf("%-40s %12.2f %12.2f %12.2f %12.2f\n", result.name.c_str(), result.median, result.p90, result.p99, result.standardDeviation);
+	}
+	
+	if (!outputPath.empty()) {
+		std::ofstream output(outputPath.c_str(), std::ios::out | std::ios::trunc);
+		output << ResultsToJSON(results, options);
+		if (!output) {
+			std::fprintf(stderr, "Could not write %s\n", outputPath.c_str());
+			return 2;
+		}
+	}
+	
+	if (baselinePath.empty()) return 0;
+	
+	std::vector<Comparison> comparisons;
+	std::string error;
+	if (!CompareWithBaseline(results, baselineJSON, threshold, comparisons, error)) {
+		std::fprintf(stderr, "Could not parse baseline %s: %s\n", baselinePath.c_str(), error.c_str());
+		return 2;
+	}
+	
+	size_t regressions = 0;
+	std::printf("\n%-40s %12s %12s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+	for (const Comparison &comparison : comparisons) {
+		std::printf("%-40s %12.2f %12.2f %+8.1f%%%s\n", comparison.name.c_str(), comparison.baselineMedian, comparison.currentMedian, comparison.change * 100, comparison.regressed ? "  REGRESSION" : "");
+		regressions += comparison.regressed;
+	}
+	if (regressions > 0) {
+		std::printf("\n%zu benchmark(s) regressed by more than %.0f%%\n", regressions, threshold * 100);
+		return 1;
+	}
+	return 0;
+}
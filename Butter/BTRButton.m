@@ -8,6 +8,7 @@
 
 #import "BTRButton.h"
 #import "BTRLabel.h"
+#import "BTRTraceInternal.h"
 
 // Subclasses to override -hitTest: and prevent them from receiving mouse events
 @interface BTRButtonLabel : BTRLabel
@@ -76,6 +77,7 @@ static void BTRButtonCommonInit(BTRButton *self) {
 #pragma mark - State
 
 - (void)handleStateChange {
+	BTRTraceScope(BTRTraceCategoryStateChange, "BTRButton.handleStateChange");
 	self.backgroundImageView.image = self.currentBackgroundImage;
 	if (self.currentImage) {
 		self.imageView.image = self.currentImage;
@@ -85,13 +87,19 @@ static void BTRButtonCommonInit(BTRButton *self) {
 
 #pragma mark - Drawing
 
-- (void)layout {
-	self.backgroundImageView.frame = [self backgroundImageFrame];
-	self.titleLabel.frame = [self labelFrame];
+- (void)applyLayout:(BTRControlLayout)layout {
+	BTRTraceScope(BTRTraceCategoryLayoutApply, "BTRButton.applyLayout");
+	// Subclasses that override the subclassing hooks take precedence.
+	Class cls = self.class;
+	if (BTRClassOverridesSelector(cls, BTRButton.class, @selector(backgroundImageFrame))) layout.backgroundImageFrame = self.backgroundImageFrame;
+	if (BTRClassOverridesSelector(cls, BTRButton.class, @selector(labelFrame))) layout.labelFrame = self.labelFrame;
+	if (BTRClassOverridesSelector(cls, BTRButton.class, @selector(imageFrame))) layout.imageFrame = self.imageFrame;
+	
+	BTRSetFrameIfNeeded(self.backgroundImageView, layout.backgroundImageFrame);
+	BTRSetFrameIfNeeded(self.titleLabel, layout.labelFrame);
 	if (_imageView) {
-		self.imageView.frame = [self imageFrame];
+		BTRSetFrameIfNeeded(_imageView, layout.imageFrame);
 	}
-	[super layout];
 }
 
 - (void)setBackgroundContentMode:(BTRViewContentMode)backgroundContentMode {
@@ -135,8 +143,11 @@ static void BTRButtonCommonInit(BTRButton *self) {
 #pragma mark - Mouse Events
 
 - (void)mouseDragged:(NSEvent *)theEvent {
-	// Override to prevent superviews from receiving mouse dragged events
-	// when the button is dragged.
+	// Superviews should never receive mouse dragged events when the button
+	// is dragged, so they are only passed on to BTRControl for handling.
+	if (self.enabled && self.userInteractionEnabled) {
+		[super mouseDragged:theEvent];
+	}
 }
 
 #pragma mark - Subclassing Hooks
@@ -45,4 +45,10 @@
 // Defaults to 0.78.
 @property (nonatomic, assign) CGFloat decelerationRate;
 
+// The rect of the document view that will be visible once any scroll animation
+// in flight has finished, in the document view's coordinate space.
+//
+// Equal to the document visible rect when no animation is in progress.
+@property (nonatomic, readonly) CGRect destinationDocumentVisibleRect;
+
 @end
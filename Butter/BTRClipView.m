@@ -18,6 +18,8 @@
  */
 
 #import "BTRClipView.h"
+#import "BTRTraceInternal.h"
+#import "BTRCoreScrollPhysics.h"
 
 // The default deceleration constant used for the ease-out curve in the animation.
 static const CGFloat BTRClipViewDecelerationRate = 0.78;
@@ -42,7 +44,11 @@ static const CGFloat BTRClipViewDecelerationRate = 0.78;
 @end
 
 
-@implementation BTRClipView
+@implementation BTRClipView {
+	// The number of origin updates dispatched from the display link thread
+	// that have not yet run on the main thread.
+	int32_t _pendingOriginUpdates;
+}
 
 - (instancetype)initWithFrame:(NSRect)frame {
 	self = [super initWithFrame:frame];
@@ -78,7 +84,13 @@ static const CGFloat BTRClipViewDecelerationRate = 0.78;
 static CVReturn BTRScrollingCallback(CVDisplayLinkRef displayLink, const CVTimeStamp *now, const CVTimeStamp *outputTime, CVOptionFlags flagsIn, CVOptionFlags *flagsOut, void *displayLinkContext) {
 	@autoreleasepool {
 		BTRClipView *clipView = (__bridge id)displayLinkContext;
+		// Every tick still queues an update, but a tick that fires before the
+		// previous update has run is counted as the main thread falling behind.
+		if (__atomic_fetch_add(&clipView->_pendingOriginUpdates, 1, __ATOMIC_RELAXED) > 0) {
+			BTRTraceCount(BTRTraceCategoryDroppedUpdate);
+		}
 		dispatch_async(dispatch_get_main_queue(), ^{
+			__atomic_fetch_sub(&clipView->_pendingOriginUpdates, 1, __ATOMIC_RELAXED);
 			[clipView updateOrigin];
 		});
 	}
@@ -180,18 +192,17 @@ static CVReturn BTRScrollingCallback(CVDisplayLinkRef displayLink, const CVTimeS
 }
 
 - (void)updateOrigin {
+	BTRTraceScope(BTRTraceCategoryDisplayLinkTick, "BTRClipView.updateOrigin");
 	if (self.window == nil) {
 		[self endScrolling];
 		return;
 	}
 	
-	CGPoint o = self.bounds.origin;
-	CGPoint lastOrigin = o;
-	CGFloat deceleration = self.decelerationRate;
-	
 	// Calculate the next origin on a basic ease-out curve.
-	o.x = o.x * deceleration + self.destinationOrigin.x * (1 - self.decelerationRate);
-	o.y = o.y * deceleration + self.destinationOrigin.y * (1 - self.decelerationRate);
+	BTRCorePoint origin = { self.bounds.origin.x, self.bounds.origin.y };
+	BTRCorePoint destination = { self.destinationOrigin.x, self.destinationOrigin.y };
+	BOOL settled = BTRCoreScrollStep(&origin, destination, self.decelerationRate);
+	CGPoint o = CGPointMake(origin.x, origin.y);
 	
 	// Calling -scrollToPoint: instead of manually adjusting the bounds lets us get the expected
 	// overlay scroller behavior for free.
@@ -200,7 +211,7 @@ static CVReturn BTRScrollingCallback(CVDisplayLinkRef displayLink, const CVTimeS
 	// Make this call so that we can force an update of the scroller positions.
 	[self.containingScrollView reflectScrolledClipView:self];
 
-	if ((fabs(o.x - lastOrigin.x) < 0.1 && fabs(o.y - lastOrigin.y) < 0.1)) {
+	if (settled) {
 		[self endScrolling];
 		
 		// Make sure we always finish out the animation with the actual coordinates
@@ -209,6 +220,16 @@ static CVReturn BTRScrollingCallback(CVDisplayLinkRef displayLink, const CVTimeS
 	}
 }
 
+- (CGRect)destinationDocumentVisibleRect {
+	if (self.documentView == nil || _displayLink == NULL || !CVDisplayLinkIsRunning(_displayLink)) {
+		return self.documentVisibleRect;
+	}
+	
+	CGRect destinationRect = self.bounds;
+	destinationRect.origin = self.destinationOrigin;
+	return [self convertRect:destinationRect toView:self.documentView];
+}
+
 #pragma mark Completion handling
 
 - (void)handleCompletionIfNeededWithSuccess:(BOOL)success {
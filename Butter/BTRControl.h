@@ -7,13 +7,11 @@
 
 // This class is heavily inspired by UIKit and TwUI.
 #import "BTRView.h"
+#import "BTRControlLayout.h"
 
 typedef NS_OPTIONS(NSUInteger, BTRControlEvents) {
-	// TODO: UNIMPLEMENTED
-	// ***************
-	BTRControlEventMouseDragEnter		= 1 << 1,
-	BTRControlEventMouseDragExit		= 1 << 2,
-	// ***************
+	BTRControlEventMouseDragEnter		= 1 << 1, // continuous
+	BTRControlEventMouseDragExit		= 1 << 2, // continuous
 	
 	BTRControlEventMouseUpInside		= 1 << 3,
 	BTRControlEventMouseDownInside		= 1 << 4,
@@ -26,7 +24,17 @@ typedef NS_OPTIONS(NSUInteger, BTRControlEvents) {
 	BTRControlEventLeftClick			= 1 << 14,
 	BTRControlEventRightClick			= 1 << 15,
 	
-	BTRControlEventValueChanged			= 1 << 16, // sliders, etc.
+	BTRControlEventValueChanged			= 1 << 16, // sliders, etc. Usually continuous.
+};
+
+// How continuous events sent with -sendContinuousActionsForControlEvents: are
+// delivered to the control's actions.
+typedef NS_ENUM(NSInteger, BTRControlContinuousEventDelivery) {
+	// Events are delivered at most once per display frame. All samples sent
+	// during the frame are coalesced into a single delivery.
+	BTRControlContinuousEventDeliveryCoalesced,
+	// Every sample is delivered immediately.
+	BTRControlContinuousEventDeliveryEverySample
 };
 
 typedef NS_OPTIONS(NSUInteger, BTRControlState) {
@@ -68,6 +76,36 @@ extern NSString * const BTRControlStateBackgroundImageKey;
 // This method should be called by subclasses
 - (void)sendActionsForControlEvents:(BTRControlEvents)events;
 
+// Should be called by subclasses instead of -sendActionsForControlEvents: for
+// events that can fire many times a second, such as BTRControlEventValueChanged
+// while dragging. Update the control's value before calling this method, so
+// that actions read the latest value when they are delivered.
+//
+// Pending continuous events are always delivered before mouse up events.
+//
+// BTRControlEventMouseDragEnter and BTRControlEventMouseDragExit are coalesced
+// to their net transition, so at most one of them is delivered, and none if the
+// mouse returned to where it was at the previous delivery. Use
+// `mouseDragInside` to read where the mouse currently is.
+- (void)sendContinuousActionsForControlEvents:(BTRControlEvents)events;
+
+// Whether the mouse is inside the control's bounds while it is being dragged
+// after a mouse down inside the control. Always up to date, even when drag
+// enter and exit events are waiting to be delivered.
+@property (nonatomic, readonly) BOOL mouseDragInside;
+
+// Defaults to BTRControlContinuousEventDeliveryCoalesced.
+@property (nonatomic, assign) BTRControlContinuousEventDelivery continuousEventDelivery;
+
+// The number of samples coalesced into the most recent delivery of continuous
+// events. Always 1 when delivering every sample.
+@property (nonatomic, readonly) NSUInteger coalescedEventCount;
+
+// The timestamps of the first and last samples coalesced into the most recent
+// delivery of continuous events, in the same time base as NSEvent timestamps.
+@property (nonatomic, readonly) NSTimeInterval firstCoalescedEventTimestamp;
+@property (nonatomic, readonly) NSTimeInterval lastCoalescedEventTimestamp;
+
 // Sends actions for the `BTRControlClick` event, provided that `enabled` and
 // `userInteractionEnabled` are equal to `YES`.
 - (IBAction)performClick:(id)sender;
@@ -80,6 +118,28 @@ extern NSString * const BTRControlStateBackgroundImageKey;
 // Returns the current value for the given control state key.
 - (id)currentValueForControlStateKey:(NSString *)key;
 
+// Implemented by subclasses. Returns a snapshot of the inputs the control's
+// layout depends on. Must be called on the main thread.
+- (BTRControlLayoutInput *)layoutInput;
+
+// Implemented by subclasses. Computes the frames of the control's content from
+// the input. This must be a pure function of the input, as it may be called on
+// any thread; see BTRLayoutPass.
++ (BTRControlLayout)layoutForInput:(BTRControlLayoutInput *)input;
+
+// Implemented by subclasses. Applies a computed layout to the control's subviews,
+// skipping any frames that haven't changed.
+- (void)applyLayout:(BTRControlLayout)layout;
+
+// While the window is in a live resize, only the bounds of a control change, so
+// the input captured for the first layout is reused for every intermediate size
+// instead of being captured (and its title measured) again. A full layout is
+// performed once the resize ends.
+//
+// State and content changes discard the reused input automatically. Subclasses
+// must call this method when any other value captured by -layoutInput changes.
+- (void)invalidateLayoutInput;
+
 // Implemented by subclasses. Use it to return a subclass of BTRControlContent that
 // contains additional content properties pertaining to the specific control.
 + (Class)controlContentClass;
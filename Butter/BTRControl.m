@@ -8,6 +8,10 @@
 
 #import "BTRControl.h"
 #import "BTRControlAction.h"
+#import "BTRCoreControl.h"
+#import "BTRFrameScheduler.h"
+#import "BTRHoverCoordinator.h"
+#import "BTRTraceInternal.h"
 
 NSString * const BTRControlStateTitleKey = @"title";
 NSString * const BTRControlStateTitleColorKey = @"titleColor";
@@ -19,13 +23,16 @@ NSString * const BTRControlStateBackgroundImageKey = @"backgroundImage";
 
 @interface BTRControl()
 @property (nonatomic, strong) NSMutableArray *actions;
-@property (nonatomic, strong) NSTrackingArea *trackingArea;
 @property (nonatomic, strong) NSMutableDictionary *content;
 
 @property (nonatomic, readwrite) NSInteger clickCount;
 @property (nonatomic) BOOL needsTrackingArea;
 @property (nonatomic) BOOL mouseInside;
 @property (nonatomic) BOOL mouseDown;
+@property (nonatomic, readwrite) BOOL mouseDragInside;
+@property (nonatomic, readwrite) NSUInteger coalescedEventCount;
+@property (nonatomic, readwrite) NSTimeInterval firstCoalescedEventTimestamp;
+@property (nonatomic, readwrite) NSTimeInterval lastCoalescedEventTimestamp;
 @property (nonatomic, readonly) BOOL shouldHandleEvents;
 
 - (void)handleStateChange;
@@ -36,7 +43,20 @@ NSString * const BTRControlStateBackgroundImageKey = @"backgroundImage";
 @property (nonatomic, weak) BTRControl *control;
 @end
 
-@implementation BTRControl
+@implementation BTRControl {
+	// The event masks of `actions`, in the same order.
+	BTRCoreActionList _actionEvents;
+	
+	// Continuous events waiting for the next frame.
+	BTRControlEvents _pendingContinuousEvents;
+	NSUInteger _pendingContinuousEventCount;
+	NSTimeInterval _pendingFirstTimestamp;
+	NSTimeInterval _pendingLastTimestamp;
+	BOOL _continuousDeliveryScheduled;
+	
+	// The layout input reused during a live resize.
+	BTRControlLayoutInput *_liveResizeLayoutInput;
+}
 
 static void BTRControlCommonInit(BTRControl *self) {
 	self.enabled = YES;
@@ -47,6 +67,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 	self.needsTrackingArea = YES;
 	self.actions = [NSMutableArray array];
 	self.content = [NSMutableDictionary dictionary];
+	BTRCoreActionListInit(&self->_actionEvents);
 }
 
 - (instancetype)initWithFrame:(NSRect)frame {
@@ -63,6 +84,41 @@ static void BTRControlCommonInit(BTRControl *self) {
 	return self;
 }
 
+- (void)dealloc {
+	BTRCoreActionListDestroy(&_actionEvents);
+}
+
+#pragma mark - Reuse
+
+// The actions array is emptied rather than replaced, so a recycled control doesn't
+// have to allocate it again. Per-state content is kept, as it is usually
+// reassigned by whoever dequeues the control.
+- (void)prepareForReuse {
+	[super prepareForReuse];
+	
+	[self.actions removeAllObjects];
+	BTRCoreActionListRemoveAll(&_actionEvents);
+	
+	_pendingContinuousEvents = 0;
+	_pendingContinuousEventCount = 0;
+	self.coalescedEventCount = 0;
+	self.firstCoalescedEventTimestamp = 0;
+	self.lastCoalescedEventTimestamp = 0;
+	
+	self.clickCount = 0;
+	self.mouseDown = NO;
+	self.mouseInside = NO;
+	self.mouseDragInside = NO;
+	self.needsTrackingArea = YES;
+	
+	_highlighted = NO;
+	_selected = NO;
+	_enabled = YES;
+	_userInteractionEnabled = YES;
+	[self accessibilitySetOverrideValue:@YES forAttribute:NSAccessibilityEnabledAttribute];
+	[self handleStateChange];
+}
+
 #pragma mark - Accessibility
 
 - (BOOL)accessibilityIsIgnored {
@@ -87,6 +143,50 @@ static void BTRControlCommonInit(BTRControl *self) {
 	return content;
 }
 
+#pragma mark - Layout
+
+- (void)layout {
+	BTRControlLayoutInput *input = nil;
+	if (self.inLiveResize) {
+		if (_liveResizeLayoutInput == nil) {
+			_liveResizeLayoutInput = self.layoutInput;
+		}
+		_liveResizeLayoutInput.bounds = self.bounds;
+		input = _liveResizeLayoutInput;
+	} else {
+		_liveResizeLayoutInput = nil;
+		input = self.layoutInput;
+	}
+	
+	[self applyLayout:[self.class layoutForInput:input]];
+	[super layout];
+}
+
+- (void)invalidateLayoutInput {
+	_liveResizeLayoutInput = nil;
+}
+
+- (void)viewDidEndLiveResize {
+	_liveResizeLayoutInput = nil;
+	self.needsLayout = YES;
+	[super viewDidEndLiveResize];
+}
+
+- (BTRControlLayoutInput *)layoutInput {
+	BTRControlLayoutInput *input = [BTRControlLayoutInput new];
+	input.bounds = self.bounds;
+	return input;
+}
+
++ (BTRControlLayout)layoutForInput:(BTRControlLayoutInput *)input {
+	CGRect bounds = input.bounds;
+	return (BTRControlLayout){ bounds, bounds, bounds, bounds };
+}
+
+- (void)applyLayout:(BTRControlLayout)layout {
+	// Implemented by subclasses
+}
+
 #pragma mark - Convenience Methods
 
 - (NSImage *)backgroundImageForControlState:(BTRControlState)state {
@@ -186,14 +286,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 #pragma mark - State
 
 - (BTRControlState)state {
-	BTRControlState state = BTRControlStateNormal;
-	if (self.enabled) {
-		if (self.highlighted) state |= self.mouseInside ? BTRControlStateHighlighted : BTRControlStateHover;
-		if (self.selected) state |= BTRControlStateSelected;
-	} else {
-		state |= BTRControlStateDisabled;
-	}
-	return state;
+	return BTRCoreControlStateResolve(self.enabled, self.highlighted, self.mouseInside, self.selected);
 }
 
 - (void)setEnabled:(BOOL)enabled {
@@ -213,12 +306,14 @@ static void BTRControlCommonInit(BTRControl *self) {
 	BOOL o = *old;
 	*old = new;
 	if (o != new) {
+		[self invalidateLayoutInput];
 		[self handleStateChange];
 	}
 }
 
 - (void)handleStateChange {
 	// Implemented by subclasses
+	BTRTraceCount(BTRTraceCategoryStateChange);
 }
 
 - (void)setUserInteractionEnabled:(BOOL)userInteractionEnabled {
@@ -246,6 +341,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 	action.block = block;
 	action.events = events;
 	[self.actions addObject:action];
+	BTRCoreActionListAppend(&_actionEvents, (uint32_t)events);
 	[self handleUpdatedEvents:events];
 }
 
@@ -255,6 +351,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 	action.action = selector;
 	action.events = events;
 	[self.actions addObject:action];
+	BTRCoreActionListAppend(&_actionEvents, (uint32_t)events);
 	[self handleUpdatedEvents:events];
 }
 
@@ -263,41 +360,21 @@ static void BTRControlCommonInit(BTRControl *self) {
 	self.needsTrackingArea = YES;
 }
 
-- (void)updateTrackingAreas {
-	if (!self.needsTrackingArea)
-		return;
-	
-	if (self.trackingArea) {
-		[self removeTrackingArea:self.trackingArea];
-		self.trackingArea = nil;
-	}
-	
-	// TODO: Figure out correct tracking to implement mouse drag
-	NSUInteger options = (NSTrackingMouseEnteredAndExited | NSTrackingActiveAlways | NSTrackingEnabledDuringMouseDrag);
-	self.trackingArea = [[NSTrackingArea alloc] initWithRect:self.bounds
-													 options:options
-													   owner:self userInfo:nil];
-	
-	// This solution comes from <http://stackoverflow.com/a/9107224/153112>
-	// Apparently if the mouse is already inside the view when the tracking
-	// area is created, mouseEntered: is never called. This remedies that issue.
-	NSPoint mouseLocation = [[self window] mouseLocationOutsideOfEventStream];
-    mouseLocation = [self convertPoint:mouseLocation fromView:nil];
-	if (NSPointInRect(mouseLocation, self.bounds)) {
-		[self mouseEntered: nil];
-	} else {
-		[self mouseExited: nil];
-	}
-	[self addTrackingArea:self.trackingArea];
-	[super updateTrackingAreas];
-}
-
+// Hover is tracked by a single coordinator per window, instead of a tracking
+// area per control that has to be rebuilt every time the view hierarchy changes.
 - (void)setNeedsTrackingArea:(BOOL)needsTrackingArea {
 	_needsTrackingArea = needsTrackingArea;
-	if (!needsTrackingArea && self.trackingArea != nil) {
-		[self removeTrackingArea:self.trackingArea];
-		self.trackingArea = nil;
-	}
+	[self btr_setTracksHover:needsTrackingArea];
+}
+
+- (void)viewWillMoveToWindow:(NSWindow *)newWindow {
+	[super viewWillMoveToWindow:newWindow];
+	[self btr_hoverViewWillMoveToWindow:newWindow];
+}
+
+- (void)viewDidMoveToWindow {
+	[super viewDidMoveToWindow];
+	[self btr_setTracksHover:self.needsTrackingArea];
 }
 
 - (void)mouseDown:(NSEvent *)event {
@@ -358,21 +435,27 @@ static void BTRControlCommonInit(BTRControl *self) {
 	}
 }
 
-//- (void)mouseDragged:(NSEvent *)theEvent {
-//	[super mouseDragged:theEvent];
-//
-//	if (self.mouseDown) {
-//		BTRControlEvents events = 1;
-//
-//		// TODO: Implement logic here
-//
-//		//[self sendActionsForControlEvents:events];
-//	}
-//}
+- (void)mouseDragged:(NSEvent *)event {
+	if (self.shouldHandleEvents && self.mouseDown) {
+		[self handleMouseDragged:event];
+	} else {
+		[super mouseDragged:event];
+	}
+}
+
+- (void)handleMouseDragged:(NSEvent *)event {
+	NSPoint point = [self convertPoint:event.locationInWindow fromView:nil];
+	BOOL inside = NSPointInRect(point, self.bounds);
+	if (inside != self.mouseDragInside) {
+		self.mouseDragInside = inside;
+		[self sendContinuousActionsForControlEvents:(inside ? BTRControlEventMouseDragEnter : BTRControlEventMouseDragExit)];
+	}
+}
 
 - (void)handleMouseDown:(NSEvent *)event {
 	self.clickCount = event.clickCount;
 	self.mouseDown = YES;
+	self.mouseDragInside = YES;
 	
 	BTRControlEvents events = 1;
 	events |= BTRControlEventMouseDownInside;
@@ -383,6 +466,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 }
 
 - (void)handleMouseUp:(NSEvent *)event {
+	[self deliverContinuousEvents];
 	self.mouseDown = NO;
 	
 	BTRControlEvents events = 1;
@@ -406,18 +490,66 @@ static void BTRControlCommonInit(BTRControl *self) {
 	self.highlighted = NO;
 }
 
+static void BTRControlPerformAction(size_t index, uint32_t events, void *context) {
+	BTRControl *self = (__bridge BTRControl *)context;
+	BTRControlAction *action = self.actions[index];
+	if (action.block != nil) {
+		action.block(events);
+	} else if (action.action != nil) { // the target can be nil
+		[NSApp sendAction:action.action to:action.target from:self];
+	}
+}
+
 - (void)sendActionsForControlEvents:(BTRControlEvents)events {
 	if (!self.shouldHandleEvents)
 		return;
 	
-	for (BTRControlAction *action in self.actions) {
-		if (action.events & events) {
-			if (action.block != nil) {
-				action.block(events);
-			} else if (action.action != nil) { // the target can be nil
-				[NSApp sendAction:action.action to:action.target from:self];
-			}
-		}
+	BTRCoreActionListDispatch(&_actionEvents, (uint32_t)events, &BTRControlPerformAction, (__bridge void *)self);
+}
+
+#pragma mark - Continuous events
+
+- (void)sendContinuousActionsForControlEvents:(BTRControlEvents)events {
+	NSTimeInterval timestamp = NSApp.currentEvent.timestamp ?: NSProcessInfo.processInfo.systemUptime;
+	if (_pendingContinuousEventCount == 0) {
+		_pendingFirstTimestamp = timestamp;
+	}
+	_pendingContinuousEvents = BTRCoreContinuousEventsCoalesce((uint32_t)_pendingContinuousEvents, (uint32_t)events);
+	_pendingContinuousEventCount++;
+	_pendingLastTimestamp = timestamp;
+	
+	if (self.continuousEventDelivery == BTRControlContinuousEventDeliveryEverySample) {
+		[self deliverContinuousEvents];
+	} else if (!_continuousDeliveryScheduled) {
+		_continuousDeliveryScheduled = YES;
+		__weak BTRControl *weakSelf = self;
+		[BTRFrameScheduler.sharedScheduler scheduleBlockForNextFrame:^(NSTimeInterval frameTimestamp) {
+			[weakSelf deliverContinuousEvents];
+		}];
+	}
+}
+
+- (void)setContinuousEventDelivery:(BTRControlContinuousEventDelivery)continuousEventDelivery {
+	_continuousEventDelivery = continuousEventDelivery;
+	if (continuousEventDelivery == BTRControlContinuousEventDeliveryEverySample) {
+		[self deliverContinuousEvents];
+	}
+}
+
+- (void)deliverContinuousEvents {
+	_continuousDeliveryScheduled = NO;
+	if (_pendingContinuousEventCount == 0) return;
+	
+	BTRControlEvents events = _pendingContinuousEvents;
+	self.coalescedEventCount = _pendingContinuousEventCount;
+	self.firstCoalescedEventTimestamp = _pendingFirstTimestamp;
+	self.lastCoalescedEventTimestamp = _pendingLastTimestamp;
+	_pendingContinuousEvents = 0;
+	_pendingContinuousEventCount = 0;
+	
+	// A drag exit and enter within the same frame cancel out.
+	if (events != 0) {
+		[self sendActionsForControlEvents:events];
 	}
 }
 
@@ -504,6 +636,7 @@ static void BTRControlCommonInit(BTRControl *self) {
 
 - (void)controlContentChanged {
 	if ((self.control.state & self.state) == self.state) {
+		[self.control invalidateLayoutInput];
 		[self.control handleStateChange];
 	}
 }
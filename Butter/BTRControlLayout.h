@@ -0,0 +1,73 @@
+//
+//  BTRControlLayout.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+
+// The frames of a control's content, in the control's coordinate space.
+//
+// Frames that don't apply to a particular control are set to its bounds.
+typedef struct {
+	CGRect backgroundImageFrame;
+	CGRect imageFrame;
+	CGRect labelFrame;
+	CGRect arrowFrame;
+} BTRControlLayout;
+
+// A snapshot of everything a control's geometry depends on, captured on the
+// main thread so that the layout can be computed on any thread.
+@interface BTRControlLayoutInput : NSObject
+
+@property (nonatomic, assign) CGRect bounds;
+@property (nonatomic, assign) CGSize imageSize;
+@property (nonatomic, assign) CGSize arrowSize;
+@property (nonatomic, copy) NSAttributedString *title;
+@property (nonatomic, assign) NSTextAlignment textAlignment;
+@property (nonatomic, assign) CGFloat edgeInset;
+@property (nonatomic, assign) CGFloat interElementSpacing;
+
+@end
+
+// Returns the size needed to draw the string in a label, including the
+// padding added by the text field cell.
+//
+// Results are cached, and this function is safe to call from any thread.
+CGSize BTRTextMetricsSizeForAttributedString(NSAttributedString *string);
+
+// Whether `cls` overrides the implementation of `selector` found in `baseClass`.
+// Used to respect subclassing hooks when applying a computed layout.
+NS_INLINE BOOL BTRClassOverridesSelector(Class cls, Class baseClass, SEL selector) {
+	return [cls instanceMethodForSelector:selector] != [baseClass instanceMethodForSelector:selector];
+}
+
+// Sets the view's frame only if it differs from the current one, avoiding the
+// resulting layout and display invalidation.
+NS_INLINE void BTRSetFrameIfNeeded(NSView *view, CGRect frame) {
+	if (!NSEqualRects(view.frame, frame)) {
+		view.frame = frame;
+	}
+}
+
+// Lays out many controls in one batch.
+//
+// The inputs of every control are captured first, then all layouts are
+// computed, then all frames are applied in a single pass on the main thread.
+// Frames that haven't changed are never set.
+@interface BTRLayoutPass : NSObject
+
+// Lays out the controls (instances of BTRControl) synchronously.
++ (void)layoutControls:(NSArray *)controls;
+
+// Computes the layouts on a background queue, then applies them on the main
+// thread and calls the completion block. Controls whose bounds changed while
+// the layout was being computed are marked as needing layout instead.
+//
+// Text is measured on the background queue, which requires thread-safe
+// string drawing (OS X 10.11 and later).
++ (void)layoutControlsAsynchronously:(NSArray *)controls completion:(void (^)(void))completion;
+
+@end
@@ -0,0 +1,82 @@
+//
+//  BTRControlLayout.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRControlLayout.h"
+#import "BTRControl.h"
+
+@implementation BTRControlLayoutInput
+@end
+
+// NSTextFieldCell draws the text inset from its bounds, so the label needs
+// to be slightly wider than the text itself to avoid truncation.
+static const CGFloat BTRTextMetricsCellPadding = 4.f;
+
+CGSize BTRTextMetricsSizeForAttributedString(NSAttributedString *string) {
+	if (string.length == 0) return CGSizeZero;
+	
+	static NSCache *cache = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		cache = [[NSCache alloc] init];
+		cache.countLimit = 1024;
+	});
+	
+	NSValue *cachedSize = [cache objectForKey:string];
+	if (cachedSize != nil) return cachedSize.sizeValue;
+	
+	NSSize size = string.size;
+	size.width = ceil(size.width) + BTRTextMetricsCellPadding;
+	size.height = ceil(size.height);
+	[cache setObject:[NSValue valueWithSize:size] forKey:[string copy]];
+	return size;
+}
+
+@implementation BTRLayoutPass
+
++ (void)layoutControls:(NSArray *)controls {
+	NSArray *inputs = [self inputsForControls:controls];
+	[controls enumerateObjectsUsingBlock:^(BTRControl *control, NSUInteger idx, BOOL *stop) {
+		[control applyLayout:[control.class layoutForInput:inputs[idx]]];
+	}];
+}
+
++ (void)layoutControlsAsynchronously:(NSArray *)controls completion:(void (^)(void))completion {
+	controls = [controls copy];
+	NSArray *inputs = [self inputsForControls:controls];
+	NSArray *classes = [controls valueForKey:@"class"];
+	
+	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
+		NSMutableData *layouts = [NSMutableData dataWithLength:controls.count * sizeof(BTRControlLayout)];
+		BTRControlLayout *layout = layouts.mutableBytes;
+		[inputs enumerateObjectsUsingBlock:^(BTRControlLayoutInput *input, NSUInteger idx, BOOL *stop) {
+			layout[idx] = [classes[idx] layoutForInput:input];
+		}];
+		
+		dispatch_async(dispatch_get_main_queue(), ^{
+			const BTRControlLayout *layout = layouts.bytes;
+			[controls enumerateObjectsUsingBlock:^(BTRControl *control, NSUInteger idx, BOOL *stop) {
+				if (NSEqualRects(control.bounds, [inputs[idx] bounds])) {
+					[control applyLayout:layout[idx]];
+				} else {
+					control.needsLayout = YES;
+				}
+			}];
+			if (completion != nil) completion();
+		});
+	});
+}
+
++ (NSArray *)inputsForControls:(NSArray *)controls {
+	NSMutableArray *inputs = [NSMutableArray arrayWithCapacity:controls.count];
+	for (BTRControl *control in controls) {
+		[inputs addObject:control.layoutInput];
+	}
+	return inputs;
+}
+
+@end
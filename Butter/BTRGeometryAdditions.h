@@ -21,17 +21,26 @@ NS_INLINE CGRect BTRNSEdgeInsetsInsetRect(CGRect rect, NSEdgeInsets insets) {
 	return newRect;
 }
 
-NS_INLINE CGRect BTRCAContentsCenterForInsets(NSEdgeInsets insets, CGSize imageSize) {
-	CGRect imageRect = BTRNSEdgeInsetsInsetRect((CGRect){.size=imageSize}, insets);
-	if (imageRect.size.width > 0) {
-		imageRect.origin.x /= imageSize.width;
-		imageRect.size.width /= imageSize.width;
-	}
-	if (imageRect.size.height > 0) {
-		imageRect.origin.y /= imageSize.height;
-		imageRect.size.height /= imageSize.height;
-	}
-	return imageRect;
+// Returns the stretchable center of an image with the given cap insets, in the
+// unit coordinate space used by CALayer's contentsCenter.
+CGRect BTRCAContentsCenterForInsets(NSEdgeInsets insets, CGSize imageSize);
+
+// Equivalent to CGPathCreateWithRoundedRect, which is not available on 10.8.
+// The radius is clamped to half of the smaller side of the rect.
+NS_INLINE CGPathRef BTRCGPathCreateWithRoundedRect(CGRect rect, CGFloat radius) CF_RETURNS_RETAINED {
+	radius = MIN(radius, MIN(CGRectGetWidth(rect), CGRectGetHeight(rect)) / 2);
+	if (radius <= 0) return CGPathCreateWithRect(rect, NULL);
+	
+	CGFloat minX = CGRectGetMinX(rect), maxX = CGRectGetMaxX(rect);
+	CGFloat minY = CGRectGetMinY(rect), maxY = CGRectGetMaxY(rect);
+	CGMutablePathRef path = CGPathCreateMutable();
+	CGPathMoveToPoint(path, NULL, minX + radius, minY);
+	CGPathAddArcToPoint(path, NULL, maxX, minY, maxX, maxY, radius);
+	CGPathAddArcToPoint(path, NULL, maxX, maxY, minX, maxY, radius);
+	CGPathAddArcToPoint(path, NULL, minX, maxY, minX, minY, radius);
+	CGPathAddArcToPoint(path, NULL, minX, minY, maxX, minY, radius);
+	CGPathCloseSubpath(path);
+	return path;
 }
 
 // NSString to Data type conversions
@@ -0,0 +1,15 @@
+//
+//  BTRGeometryAdditions.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRGeometryAdditions.h"
+#import "BTRCoreNineSlice.h"
+
+CGRect BTRCAContentsCenterForInsets(NSEdgeInsets insets, CGSize imageSize) {
+	BTRCoreRect center = BTRCoreNineSliceContentsCenter((BTRCoreEdgeInsets){ insets.top, insets.left, insets.bottom, insets.right }, imageSize.width, imageSize.height);
+	return CGRectMake(center.x, center.y, center.width, center.height);
+}
@@ -9,6 +9,8 @@
 #import "BTRImageView.h"
 #import "BTRGeometryAdditions.h"
 #import "BTRImage.h"
+#import "BTRCoreNineSlice.h"
+#import "BTRTraceInternal.h"
 
 @interface BTRImageView()
 @property (nonatomic, strong, readwrite) CALayer *imageLayer;
@@ -20,6 +22,10 @@
 	NSInteger _animationLoopCount;
 	NSInteger _currentLoopCount;
 	NSTimer *_animationTimer;
+	
+	// The image or animation frame currently shown.
+	NSImage *_displayedImage;
+	CGFloat _cornerRadius;
 }
 
 - (instancetype)initWithFrame:(NSRect)frame {
@@ -70,7 +76,7 @@ static void BTRImageViewCommonInit(BTRImageView *self) {
 	[_animationTimer invalidate];
 	_animationTimer = nil;
 	_image = image;
-	self.imageLayer.contents = image;
+	[self displayImage:image];
 	
 	if ([image isKindOfClass:BTRImage.class]) {
 		NSSize imageSize = image.size;
@@ -93,6 +99,17 @@ static void BTRImageViewCommonInit(BTRImageView *self) {
 	}	
 }
 
+- (void)prepareForReuse {
+	[super prepareForReuse];
+	
+	[_animationTimer invalidate];
+	_animationTimer = nil;
+	_image = nil;
+	[self.imageLayer removeAllAnimations];
+	[self displayImage:nil];
+	self.imageLayer.transform = CATransform3DIdentity;
+}
+
 - (void)imageAnimationTimerFired:(NSTimer *)timer {
 	if (timer) _currentImageFrame++;
 	if (_currentImageFrame > _totalImageFrames - 1) {
@@ -103,9 +120,10 @@ static void BTRImageViewCommonInit(BTRImageView *self) {
 	NSBitmapImageRep *rep = self.image.representations[0];
 	[rep setProperty:NSImageCurrentFrame withValue:@(_currentImageFrame)];
 	if (!NSEqualRects(self.visibleRect, NSZeroRect)) {
+		BTRTraceScope(BTRTraceCategoryImageFrameDecode, "BTRImageView.decodeFrame");
 		NSImage *currentFrameImage = [NSImage new];
 		[currentFrameImage addRepresentation:rep];
-		self.imageLayer.contents = currentFrameImage;
+		[self displayImage:currentFrameImage];
 	}
 	_animationTimer = [NSTimer scheduledTimerWithTimeInterval:[[rep valueForProperty:NSImageCurrentFrameDuration] doubleValue] target:self selector:@selector(imageAnimationTimerFired:) userInfo:nil repeats:NO];
 }
@@ -115,16 +133,135 @@ static void BTRImageViewCommonInit(BTRImageView *self) {
 	self.imageLayer.contentsScale = self.layer.contentsScale;
 }
 
-#pragma mark Layer properties
+#pragma mark Rounded corners
+
+// Rounding the image layer with a corner radius and masksToBounds would
+// require an offscreen pass. Instead, a rounded image is drawn into the layer
+// clipped to its rounded bounds, and the layer only displays the image as its
+// contents while the corners are square.
+- (void)displayImage:(NSImage *)image {
+	_displayedImage = image;
+	if (_cornerRadius > 0) {
+		self.imageLayer.contents = nil;
+		[self.imageLayer setNeedsDisplay];
+	} else {
+		self.imageLayer.contents = image;
+	}
+}
 
 - (void)setCornerRadius:(CGFloat)cornerRadius {
-	self.imageLayer.cornerRadius = cornerRadius;
+	if (_cornerRadius == cornerRadius) return;
+	_cornerRadius = cornerRadius;
+	self.imageLayer.needsDisplayOnBoundsChange = (cornerRadius > 0);
+	[self displayImage:_displayedImage];
+	// Picks up the new radius for the shadow path.
+	self.needsLayout = YES;
 }
 
 - (CGFloat)cornerRadius {
-	return self.imageLayer.cornerRadius;
+	return _cornerRadius;
+}
+
+// The rect the image is drawn into, positioned the same way as the
+// contentsGravity of the content mode positions the layer's contents.
+static CGRect BTRImageViewImageRect(BTRViewContentMode contentMode, CGRect bounds, CGSize imageSize) {
+	if (contentMode == BTRViewContentModeScaleToFill || imageSize.width <= 0 || imageSize.height <= 0) return bounds;
+	
+	CGSize size = imageSize;
+	if (contentMode == BTRViewContentModeScaleAspectFit || contentMode == BTRViewContentModeScaleAspectFill) {
+		CGFloat widthScale = CGRectGetWidth(bounds) / imageSize.width;
+		CGFloat heightScale = CGRectGetHeight(bounds) / imageSize.height;
+		CGFloat scale = (contentMode == BTRViewContentModeScaleAspectFit ? MIN(widthScale, heightScale) : MAX(widthScale, heightScale));
+		size = CGSizeMake(imageSize.width * scale, imageSize.height * scale);
+	}
+	
+	CGRect rect = { .size = size };
+	switch (contentMode) {
+		case BTRViewContentModeLeft:
+		case BTRViewContentModeTopLeft:
+		case BTRViewContentModeBottomLeft:
+			rect.origin.x = CGRectGetMinX(bounds);
+			break;
+		case BTRViewContentModeRight:
+		case BTRViewContentModeTopRight:
+		case BTRViewContentModeBottomRight:
+			rect.origin.x = CGRectGetMaxX(bounds) - size.width;
+			break;
+		default:
+			rect.origin.x = CGRectGetMidX(bounds) - size.width / 2;
+			break;
+	}
+	switch (contentMode) {
+		case BTRViewContentModeTop:
+		case BTRViewContentModeTopLeft:
+		case BTRViewContentModeTopRight:
+			rect.origin.y = CGRectGetMaxY(bounds) - size.height;
+			break;
+		case BTRViewContentModeBottom:
+		case BTRViewContentModeBottomLeft:
+		case BTRViewContentModeBottomRight:
+			rect.origin.y = CGRectGetMinY(bounds);
+			break;
+		default:
+			rect.origin.y = CGRectGetMidY(bounds) - size.height / 2;
+			break;
+	}
+	return rect;
 }
 
+static BOOL BTRImageViewIsResizableImage(NSImage *image) {
+	if (![image isKindOfClass:BTRImage.class]) return NO;
+	NSEdgeInsets insets = ((BTRImage *)image).btr_capInsets;
+	return insets.top > 0 || insets.left > 0 || insets.bottom > 0 || insets.right > 0;
+}
+
+// Draws a resizable image by stretching its slices, as the contentsCenter of
+// the layer would. The slices are laid out from the top, so they are flipped
+// into the unflipped coordinates of the image and the context.
+static void BTRImageViewDrawNineSliceImage(BTRImage *image, CGRect rect) {
+	NSSize imageSize = image.size;
+	NSEdgeInsets insets = image.btr_capInsets;
+	BTRCoreRect sourceRects[9], destinationRects[9];
+	BTRCoreNineSliceLayout(imageSize.width, imageSize.height, (BTRCoreEdgeInsets){ insets.top, insets.left, insets.bottom, insets.right }, (BTRCoreRect){ 0, 0, rect.size.width, rect.size.height }, sourceRects, destinationRects);
+	
+	for (int i = 0; i < 9; i++) {
+		BTRCoreRect source = sourceRects[i], destination = destinationRects[i];
+		if (destination.width <= 0) continue;
+		NSRect fromRect = NSMakeRect(source.x, imageSize.height - source.y - source.height, source.width, source.height);
+		NSRect toRect = NSMakeRect(NSMinX(rect) + destination.x, NSMaxY(rect) - destination.y - destination.height, destination.width, destination.height);
+		[image drawInRect:toRect fromRect:fromRect operation:NSCompositeSourceOver fraction:1 respectFlipped:NO hints:nil];
+	}
+}
+
+- (void)drawLayer:(CALayer *)layer inContext:(CGContextRef)ctx {
+	if (layer != self.imageLayer) {
+		[super drawLayer:layer inContext:ctx];
+		return;
+	}
+	
+	NSImage *image = _displayedImage;
+	if (image == nil) return;
+	BTRTraceScope(BTRTraceCategoryDraw, "BTRImageView.drawRoundedImage");
+	
+	CGRect bounds = layer.bounds;
+	CGPathRef path = BTRCGPathCreateWithRoundedRect(bounds, _cornerRadius);
+	CGContextAddPath(ctx, path);
+	CGContextClip(ctx);
+	CGPathRelease(path);
+	
+	[NSGraphicsContext saveGraphicsState];
+	[NSGraphicsContext setCurrentContext:[NSGraphicsContext graphicsContextWithGraphicsPort:ctx flipped:NO]];
+	CGRect rect = BTRImageViewImageRect(self.contentMode, bounds, image.size);
+	if (BTRImageViewIsResizableImage(image) && self.contentMode == BTRViewContentModeScaleToFill) {
+		BTRImageViewDrawNineSliceImage((BTRImage *)image, rect);
+	} else {
+		[image drawInRect:rect fromRect:NSZeroRect operation:NSCompositeSourceOver fraction:1 respectFlipped:NO hints:nil];
+	}
+	[NSGraphicsContext restoreGraphicsState];
+}
+
+#pragma mark Layer properties
+
 - (void)setTransform:(CATransform3D)transform {
 	self.imageLayer.transform = transform;
 }
@@ -142,6 +279,9 @@ static void BTRImageViewCommonInit(BTRImageView *self) {
 - (void)setContentMode:(BTRViewContentMode)contentMode {
 	_contentMode = contentMode;
 	self.imageLayer.contentsGravity = [self contentsGravityFromContentMode:contentMode];
+	if (_cornerRadius > 0) {
+		[self.imageLayer setNeedsDisplay];
+	}
 }
 
 - (NSString *)contentsGravityFromContentMode:(BTRViewContentMode)contentMode {
@@ -8,6 +8,8 @@
 
 #import "BTRPopUpButton.h"
 #import "BTRLabel.h"
+#import "BTRTraceInternal.h"
+#import "BTRCoreControl.h"
 
 @interface BTRPopUpButtonLabel : BTRLabel
 @end
@@ -115,6 +117,8 @@ static void BTRPopupButtonCommonInit(BTRPopUpButton *self) {
 }
 
 - (void)handleStateChange {
+	BTRTraceScope(BTRTraceCategoryStateChange, "BTRPopUpButton.handleStateChange");
+	[self invalidateLayoutInput];
 	NSString *title = self.selectedItem.title;
 	if (title) {
 		self.label.textColor = self.currentTitleColor;
@@ -198,6 +202,7 @@ static void BTRPopupButtonCommonInit(BTRPopUpButton *self) {
 - (void)setTextAlignment:(NSTextAlignment)textAlignment {
 	if (_textAlignment != textAlignment) {
 		_textAlignment = textAlignment;
+		[self invalidateLayoutInput];
 		[self setNeedsLayout:YES];
 	}
 }
@@ -244,57 +249,99 @@ static void BTRPopupButtonCommonInit(BTRPopUpButton *self) {
 
 #pragma mark - Layout
 
-- (void)layout {
-	self.imageView.frame = [self imageFrame];
-	self.label.frame = [self labelFrame];
-	self.arrowImageView.frame = [self arrowFrame];
-	self.backgroundImageView.frame = self.bounds;
-	[super layout];
+- (BTRControlLayoutInput *)layoutInput {
+	BTRControlLayoutInput *input = [super layoutInput];
+	input.imageSize = self.selectedItem.image.size;
+	input.arrowSize = self.currentArrowImage.size;
+	input.title = self.label.attributedStringValue;
+	input.textAlignment = self.textAlignment;
+	input.edgeInset = self.edgeInset;
+	input.interElementSpacing = self.interElementSpacing;
+	return input;
 }
 
-- (NSRect)imageFrame {
-	const NSSize imageSize = self.selectedItem.image.size;
-	// Size the image rect to the exact height and width of the selected image
-	return NSMakeRect([self edgeInset], roundf(NSMidY(self.bounds) - (imageSize.height / 2.f)), imageSize.width, imageSize.height);
+NS_INLINE BTRCoreRect BTRCoreRectFromRect(CGRect rect) {
+	return (BTRCoreRect){ rect.origin.x, rect.origin.y, rect.size.width, rect.size.height };
 }
 
-- (NSRect)labelFrame {
-	const NSRect imageFrame = [self imageFrame];
-	const NSRect arrowFrame = [self arrowFrame];
-	const CGFloat spacing = [self interElementSpacing];
-	
-	CGFloat maximumWidth = NSWidth(self.bounds) - NSMaxX(imageFrame) - NSWidth(arrowFrame) - [self edgeInset];
-	if (NSWidth(imageFrame)) {
-		maximumWidth -= spacing;
-	}
-	if (NSWidth(arrowFrame)) {
-		maximumWidth -= spacing;
-	}
-	
-	// Calling -sizeToFit modifies the frame of the label. This is necessary
-	// to get accurate metrics for the intrinsic content size.
-	[self.label sizeToFit];
-	const CGFloat textWidth = fminf(NSWidth(self.label.frame), maximumWidth);
-	CGFloat xOrigin;
-	switch (self.textAlignment) {
+NS_INLINE CGRect BTRRectFromCoreRect(BTRCoreRect rect) {
+	return CGRectMake(rect.x, rect.y, rect.width, rect.height);
+}
+
+// Size the image and arrow rects to the exact height and width of their images
+static CGRect BTRPopUpButtonImageFrame(CGRect bounds, CGSize imageSize, CGFloat edgeInset) {
+	return BTRRectFromCoreRect(BTRCorePopUpButtonImageFrame(BTRCoreRectFromRect(bounds), imageSize.width, imageSize.height, edgeInset));
+}
+
+static CGRect BTRPopUpButtonArrowFrame(CGRect bounds, CGSize arrowSize, CGFloat edgeInset) {
+	return BTRRectFromCoreRect(BTRCorePopUpButtonArrowFrame(BTRCoreRectFromRect(bounds), arrowSize.width, arrowSize.height, edgeInset));
+}
+
+static CGRect BTRPopUpButtonLabelFrame(BTRControlLayoutInput *input, CGRect imageFrame, CGRect arrowFrame) {
+	BTRCoreTextAlignment alignment;
+	switch (input.textAlignment) {
 		case NSRightTextAlignment:
-			xOrigin = NSMinX(arrowFrame) - spacing - textWidth;
+			alignment = BTRCoreTextAlignmentRight;
 			break;
 		case NSCenterTextAlignment:
-			xOrigin = floorf(NSMidX(self.bounds) - (textWidth / 2.f));
+			alignment = BTRCoreTextAlignmentCenter;
 			break;
-		case NSLeftTextAlignment:
 		default:
-			xOrigin = NSMaxX(imageFrame) + spacing;
+			alignment = BTRCoreTextAlignmentLeft;
 			break;
 	}
-	return NSMakeRect(xOrigin, 0.f, textWidth, NSHeight(self.bounds));
+	// The cached text metrics replace calling -sizeToFit on the label, which
+	// could only be done on the main thread and resized the label as a side effect.
+	const CGFloat titleWidth = BTRTextMetricsSizeForAttributedString(input.title).width;
+	return BTRRectFromCoreRect(BTRCorePopUpButtonLabelFrame(BTRCoreRectFromRect(input.bounds), BTRCoreRectFromRect(imageFrame), BTRCoreRectFromRect(arrowFrame), titleWidth, alignment, input.edgeInset, input.interElementSpacing));
+}
+
++ (BTRControlLayout)layoutForInput:(BTRControlLayoutInput *)input {
+	BTRControlLayout layout;
+	layout.backgroundImageFrame = input.bounds;
+	layout.imageFrame = BTRPopUpButtonImageFrame(input.bounds, input.imageSize, input.edgeInset);
+	layout.arrowFrame = BTRPopUpButtonArrowFrame(input.bounds, input.arrowSize, input.edgeInset);
+	layout.labelFrame = BTRPopUpButtonLabelFrame(input, layout.imageFrame, layout.arrowFrame);
+	return layout;
+}
+
+- (void)applyLayout:(BTRControlLayout)layout {
+	BTRTraceScope(BTRTraceCategoryLayoutApply, "BTRPopUpButton.applyLayout");
+	// Subclasses that override the subclassing hooks take precedence. The label
+	// is placed between the image and arrow, so it follows their hooks too.
+	Class cls = self.class;
+	BOOL overridesImageFrame = BTRClassOverridesSelector(cls, BTRPopUpButton.class, @selector(imageFrame));
+	BOOL overridesArrowFrame = BTRClassOverridesSelector(cls, BTRPopUpButton.class, @selector(arrowFrame));
+	if (overridesImageFrame) layout.imageFrame = self.imageFrame;
+	if (overridesArrowFrame) layout.arrowFrame = self.arrowFrame;
+	if (BTRClassOverridesSelector(cls, BTRPopUpButton.class, @selector(labelFrame))) {
+		layout.labelFrame = self.labelFrame;
+	} else if (overridesImageFrame || overridesArrowFrame) {
+		layout.labelFrame = [self labelFrameWithImageFrame:layout.imageFrame arrowFrame:layout.arrowFrame];
+	}
+	
+	BTRSetFrameIfNeeded(self.imageView, layout.imageFrame);
+	BTRSetFrameIfNeeded(self.label, layout.labelFrame);
+	BTRSetFrameIfNeeded(self.arrowImageView, layout.arrowFrame);
+	BTRSetFrameIfNeeded(self.backgroundImageView, layout.backgroundImageFrame);
+}
+
+- (NSRect)labelFrameWithImageFrame:(NSRect)imageFrame arrowFrame:(NSRect)arrowFrame {
+	return BTRPopUpButtonLabelFrame(self.layoutInput, imageFrame, arrowFrame);
+}
+
+// The hooks compute only their own frame, so the image and arrow frames never
+// measure the title.
+- (NSRect)imageFrame {
+	return BTRPopUpButtonImageFrame(self.bounds, self.selectedItem.image.size, self.edgeInset);
+}
+
+- (NSRect)labelFrame {
+	return [self labelFrameWithImageFrame:self.imageFrame arrowFrame:self.arrowFrame];
 }
 
 - (NSRect)arrowFrame {
-	const NSSize arrowSize = self.currentArrowImage.size;
-	// Size the arrow image to the exact height and width of the image
-	return NSMakeRect(NSMaxX(self.bounds) - arrowSize.width - [self edgeInset], roundf(NSMidY(self.bounds) - (arrowSize.height / 2.f)), arrowSize.width, arrowSize.height);
+	return BTRPopUpButtonArrowFrame(self.bounds, self.currentArrowImage.size, self.edgeInset);
 }
 
 - (CGFloat)interElementSpacing {
@@ -306,11 +353,12 @@ static void BTRPopupButtonCommonInit(BTRPopUpButton *self) {
 }
 
 - (CGFloat)widthToFit {
-	// Need to tack on padding here because NSTextFieldCell does some weird padding stuff
+	// The text metrics include padding because NSTextFieldCell does some weird padding stuff
 	// that causes the actual drawing bounds of the text to be less than the width of the text field.
 	// I've already tried a bunch of stuff like NSTextFieldCell's -cellSizeForBounds:, -drawingRectForBounds:,
 	// and none of them return a properly sized rect.
-	return NSWidth([self imageFrame]) + ceilf(self.label.attributedStringValue.size.width) + NSWidth([self arrowFrame]) + (2.f * [self edgeInset]) + (2.f * [self interElementSpacing]) + 4.f;
+	const CGFloat textWidth = BTRTextMetricsSizeForAttributedString(self.label.attributedStringValue).width;
+	return NSWidth([self imageFrame]) + textWidth + NSWidth([self arrowFrame]) + (2.f * [self edgeInset]) + (2.f * [self interElementSpacing]);
 }
 
 - (void)sizeToFit {
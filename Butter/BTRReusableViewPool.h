@@ -0,0 +1,57 @@
+//
+//  BTRReusableViewPool.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+
+// A pool of views that can be recycled instead of being created and destroyed,
+// such as the rows of a long list inside a BTRScrollView.
+//
+// Views are grouped by reuse identifier. Views returned to the pool are removed
+// from their superview and sent -prepareForReuse (if they respond to it) before
+// being kept for the next dequeue with the same identifier.
+@interface BTRReusableViewPool : NSObject
+
+// Registers the class instantiated by -dequeueViewWithIdentifier: when no view
+// with the identifier is available. The class must be an NSView subclass.
+- (void)registerClass:(Class)viewClass forIdentifier:(NSString *)identifier;
+
+// Returns a recycled view with the identifier, or a new instance of the class
+// registered for it. Returns nil if no class is registered for the identifier.
+- (id)dequeueViewWithIdentifier:(NSString *)identifier;
+
+// Returns a view to the pool. If the pool already holds the maximum number of
+// views for the identifier, the view is discarded instead.
+- (void)enqueueView:(NSView *)view withIdentifier:(NSString *)identifier;
+
+// Returns every subview of `view` that was dequeued from this pool and no longer
+// intersects `rect` (in `view`'s coordinate space) back to the pool.
+- (void)enqueueSubviewsOfView:(NSView *)view outsideRect:(NSRect)rect;
+
+// The maximum number of idle views kept for each identifier.
+//
+// Defaults to 32.
+@property (nonatomic, assign) NSUInteger maximumCountPerIdentifier;
+
+// Discards all idle views.
+- (void)removeAllViews;
+
+// The number of calls to -dequeueViewWithIdentifier:.
+@property (nonatomic, readonly) NSUInteger dequeueCount;
+
+// The number of dequeues satisfied by a recycled view.
+@property (nonatomic, readonly) NSUInteger reuseCount;
+
+// The number of views discarded because the pool was full.
+@property (nonatomic, readonly) NSUInteger discardCount;
+
+// The fraction of dequeues satisfied by a recycled view, from 0 to 1.
+@property (nonatomic, readonly) double hitRate;
+
+- (void)resetMetrics;
+
+@end
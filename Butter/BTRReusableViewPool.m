@@ -0,0 +1,113 @@
+//
+//  BTRReusableViewPool.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRReusableViewPool.h"
+
+@interface BTRReusableViewPool ()
+@property (nonatomic, readwrite) NSUInteger dequeueCount;
+@property (nonatomic, readwrite) NSUInteger reuseCount;
+@property (nonatomic, readwrite) NSUInteger discardCount;
+@end
+
+@implementation BTRReusableViewPool {
+	NSMutableDictionary *_registeredClasses;
+	NSMutableDictionary *_idleViews;
+	// Views vended by the pool -> their reuse identifier.
+	NSMapTable *_vendedViews;
+}
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+	
+	_maximumCountPerIdentifier = 32;
+	_registeredClasses = [NSMutableDictionary dictionary];
+	_idleViews = [NSMutableDictionary dictionary];
+	_vendedViews = [NSMapTable weakToStrongObjectsMapTable];
+	
+	return self;
+}
+
+#pragma mark Reuse
+
+- (void)registerClass:(Class)viewClass forIdentifier:(NSString *)identifier {
+	NSParameterAssert([viewClass isSubclassOfClass:NSView.class]);
+	NSParameterAssert(identifier);
+	_registeredClasses[identifier] = viewClass;
+}
+
+- (id)dequeueViewWithIdentifier:(NSString *)identifier {
+	NSParameterAssert(identifier);
+	self.dequeueCount++;
+	
+	NSMutableArray *idleViews = _idleViews[identifier];
+	NSView *view = idleViews.lastObject;
+	if (view != nil) {
+		[idleViews removeLastObject];
+		self.reuseCount++;
+	} else {
+		Class viewClass = _registeredClasses[identifier];
+		NSAssert(viewClass != nil, @"No class registered for reuse identifier %@", identifier);
+		view = [[viewClass alloc] initWithFrame:NSZeroRect];
+		if (view == nil) return nil;
+	}
+	
+	[_vendedViews setObject:identifier forKey:view];
+	return view;
+}
+
+- (void)enqueueView:(NSView *)view withIdentifier:(NSString *)identifier {
+	NSParameterAssert(view);
+	NSParameterAssert(identifier);
+	
+	[_vendedViews removeObjectForKey:view];
+	[view removeFromSuperview];
+	
+	NSMutableArray *idleViews = _idleViews[identifier];
+	if (idleViews == nil) {
+		idleViews = [NSMutableArray array];
+		_idleViews[identifier] = idleViews;
+	}
+	if (idleViews.count >= self.maximumCountPerIdentifier) {
+		self.discardCount++;
+		return;
+	}
+	
+	if ([view respondsToSelector:@selector(prepareForReuse)]) {
+		[(id)view prepareForReuse];
+	}
+	[idleViews addObject:view];
+}
+
+- (void)enqueueSubviewsOfView:(NSView *)view outsideRect:(NSRect)rect {
+	// Enqueuing removes the subview from `view`, so iterate over a copy.
+	for (NSView *subview in [view.subviews copy]) {
+		NSString *identifier = [_vendedViews objectForKey:subview];
+		if (identifier != nil && !NSIntersectsRect(subview.frame, rect)) {
+			[self enqueueView:subview withIdentifier:identifier];
+		}
+	}
+}
+
+- (void)removeAllViews {
+	[_idleViews removeAllObjects];
+}
+
+#pragma mark Metrics
+
+- (double)hitRate {
+	return (self.dequeueCount > 0 ? (double)self.reuseCount / self.dequeueCount : 0);
+}
+
+- (void)resetMetrics {
+	self.dequeueCount = 0;
+	self.reuseCount = 0;
+	self.discardCount = 0;
+}
+
+@end
@@ -20,6 +20,8 @@
 #import <Cocoa/Cocoa.h>
 #import "BTRClipView.h"
 
+@class BTRReusableViewPool;
+
 // A NSScrollView subclass which uses an instance of BTRClipView
 // as the clip view instead of NSClipView.
 //
@@ -30,4 +32,15 @@
 // nil if it does not exist.
 @property (readonly, strong) BTRClipView *clipView;
 
+// The pool used to recycle the document view's subviews.
+//
+// When set, any subview of the document view that was dequeued from the pool
+// is returned to it as soon as it scrolls out of the visible rect.
+@property (nonatomic, strong) BTRReusableViewPool *reusableViewPool;
+
+// Called whenever the document's visible rect changes, after offscreen views
+// have been returned to `reusableViewPool`. Use it to dequeue views for the
+// content that became visible.
+@property (nonatomic, copy) void (^documentVisibleRectChangedHandler)(BTRScrollView *scrollView, NSRect visibleRect);
+
 @end
@@ -19,6 +19,7 @@
 
 #import "BTRScrollView.h"
 #import "BTRClipView.h"
+#import "BTRReusableViewPool.h"
 
 @implementation BTRScrollView
 
@@ -49,14 +50,43 @@
 	return nil;
 }
 
+- (void)dealloc {
+	[NSNotificationCenter.defaultCenter removeObserver:self];
+}
+
 #pragma mark Clip view swapping
 
 - (void)swapClipView {
 	self.wantsLayer = YES;
 	id documentView = self.documentView;
 	BTRClipView *clipView = [[BTRClipView alloc] initWithFrame:self.contentView.frame];
+	[NSNotificationCenter.defaultCenter removeObserver:self name:NSViewBoundsDidChangeNotification object:self.contentView];
 	self.contentView = clipView;
 	self.documentView = documentView;
+	
+	clipView.postsBoundsChangedNotifications = YES;
+	[NSNotificationCenter.defaultCenter addObserver:self selector:@selector(clipViewBoundsDidChange:) name:NSViewBoundsDidChangeNotification object:clipView];
+}
+
+#pragma mark View reuse
+
+- (void)clipViewBoundsDidChange:(NSNotification *)notification {
+	[self documentVisibleRectDidChange];
+}
+
+- (void)tile {
+	[super tile];
+	[self documentVisibleRectDidChange];
+}
+
+- (void)documentVisibleRectDidChange {
+	if (self.reusableViewPool == nil && self.documentVisibleRectChangedHandler == nil) return;
+	
+	NSRect visibleRect = self.documentVisibleRect;
+	[self.reusableViewPool enqueueSubviewsOfView:self.documentView outsideRect:visibleRect];
+	if (self.documentVisibleRectChangedHandler != nil) {
+		self.documentVisibleRectChangedHandler(self, visibleRect);
+	}
 }
 
 @end
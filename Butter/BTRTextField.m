@@ -8,6 +8,9 @@
 
 #import "BTRTextField.h"
 #import "BTRControlAction.h"
+#import "BTRHoverCoordinator.h"
+#import "BTRTextFieldSupport.h"
+#import "BTRTraceInternal.h"
 #import <QuartzCore/QuartzCore.h>
 
 @interface BTRTextField()
@@ -18,7 +21,6 @@
 @property (nonatomic) BOOL mouseDown;
 @property (nonatomic) BOOL mouseHover;
 @property (nonatomic, readwrite) NSInteger clickCount;
-@property (nonatomic, strong) NSTrackingArea *trackingArea;
 @property (nonatomic, assign) BOOL needsTrackingArea;
 
 @property (nonatomic, strong) NSMutableDictionary *placeholderAttributes;
@@ -115,6 +117,12 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 // TODO: Investigate this more.
 - (void)viewDidMoveToWindow {
 	[self setNeedsDisplay:YES];
+	[self btr_setTracksHover:self.needsTrackingArea];
+}
+
+- (void)viewWillMoveToWindow:(NSWindow *)newWindow {
+	[super viewWillMoveToWindow:newWindow];
+	[self btr_hoverViewWillMoveToWindow:newWindow];
 }
 
 + (Class)cellClass {
@@ -123,7 +131,32 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 
 - (void)setFrame:(NSRect)frameRect {
 	[super setFrame:frameRect];
-	[self setNeedsDisplay:YES];
+	// During a live resize, the field is redrawn once the resize ends.
+	if (!self.inLiveResize) {
+		[self setNeedsDisplay:YES];
+	}
+}
+
+- (void)setFrameSize:(NSSize)newSize {
+	[super setFrameSize:newSize];
+	[self updateFocusRingShadowPath];
+}
+
+- (void)updateFocusRingShadowPath {
+	if (!self.drawsFocusRing) return;
+	[self btr_updateFocusRingShadowPathWithCornerRadius:BTRTextFieldCornerRadius];
+}
+
+#pragma mark - Live Resize
+
+- (void)viewWillStartLiveResize {
+	[super viewWillStartLiveResize];
+	[self btr_beginLiveResizeWithCornerRadius:BTRTextFieldCornerRadius drawsBackground:self.drawsBackground];
+}
+
+- (void)viewDidEndLiveResize {
+	[super viewDidEndLiveResize];
+	[self btr_endLiveResize];
 }
 
 #pragma mark - Accessors
@@ -138,6 +171,7 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 			shadow.shadowColor = BTRTextFieldShadowColor;
 			shadow.shadowOffset = CGSizeZero;
 			self.shadow = shadow;
+			[self updateFocusRingShadowPath];
 		} else {
 			NSShadow *shadow = [[NSShadow alloc] init];
 			shadow.shadowBlurRadius = 0.f;
@@ -259,6 +293,7 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 #pragma mark Drawing
 
 - (void)drawBackgroundInRect:(NSRect)rect {
+	BTRTraceScope(BTRTraceCategoryDraw, "BTRTextField.drawBackgroundInRect");
 	if (!self.drawsBackground) return;
 	NSImage *image = [self backgroundImageForControlState:self.state] ?: [self backgroundImageForControlState:BTRControlStateNormal];
 	if (image) {
@@ -312,23 +347,6 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 
 #pragma mark - BTRControl
 
-- (void)updateTrackingAreas {
-	if (!self.needsTrackingArea)
-		return;
-	
-	if (self.trackingArea) {
-		[self removeTrackingArea:self.trackingArea];
-		self.trackingArea = nil;
-	}
-	
-	// TODO: Figure out correct tracking to implement mouse drag
-	NSUInteger options = (NSTrackingMouseEnteredAndExited | NSTrackingActiveAlways | NSTrackingEnabledDuringMouseDrag);
-	self.trackingArea = [[NSTrackingArea alloc] initWithRect:self.bounds
-													 options:options
-													   owner:self userInfo:nil];
-	[self addTrackingArea:self.trackingArea];
-}
-
 - (void)setMouseHover:(BOOL)mouseHover {
     _mouseHover = mouseHover;
 }
@@ -353,10 +371,7 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 
 - (void)setNeedsTrackingArea:(BOOL)needsTrackingArea {
 	_needsTrackingArea = needsTrackingArea;
-	if (!needsTrackingArea && self.trackingArea != nil) {
-		[self removeTrackingArea:self.trackingArea];
-		self.trackingArea = nil;
-	}
+	[self btr_setTracksHover:needsTrackingArea];
 }
 
 - (void)mouseDown:(NSEvent *)event {
@@ -452,6 +467,8 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 }
 
 - (BOOL)becomeFirstResponder {
+	// The layer may not have existed when the frame was last set.
+	[self updateFocusRingShadowPath];
 	[self.layer addAnimation:[self shadowOpacityAnimation] forKey:nil];
 	self.layer.shadowOpacity = 1.f;
 	self.highlighted = YES;
@@ -503,7 +520,11 @@ static void BTRTextFieldCommonInit(BTRTextField *textField) {
 - (void)drawInteriorWithFrame:(NSRect)cellFrame inView:(NSView *)controlView {
 	NSRect integralFrame = NSIntegralRect(cellFrame);
 	BTRTextField *textField = (BTRTextField *)controlView;
-	[textField drawBackgroundInRect:integralFrame];
+	BTRTextFieldDrawingParts parts = textField.btr_drawingParts;
+	if (parts & BTRTextFieldDrawingPartBackground) {
+		[textField drawBackgroundInRect:integralFrame];
+	}
+	if (!(parts & BTRTextFieldDrawingPartText)) return;
 	if (textField.highlighted && ![textField.stringValue length]) {
 		NSRect placeholderRect = [self drawingRectForBounds:cellFrame];
 		placeholderRect.origin.x += 2.f;
@@ -0,0 +1,77 @@
+//
+//  BTRTrace.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Butter's hot paths are instrumented with counters and timing spans. Define
+// BTR_TRACE_ENABLED to 0 when building Butter to compile the instrumentation
+// out entirely, in which case the methods below report nothing.
+#ifndef BTR_TRACE_ENABLED
+#define BTR_TRACE_ENABLED 1
+#endif
+
+typedef NS_ENUM(NSUInteger, BTRTraceCategory) {
+	// -handleStateChange calls on controls.
+	BTRTraceCategoryStateChange,
+	// -layout passes on Butter views.
+	BTRTraceCategoryLayout,
+	// Computed control layouts applied to subviews.
+	BTRTraceCategoryLayoutApply,
+	// Synchronous and asynchronous drawing of view contents, including
+	// -drawBackgroundInRect: on text fields.
+	BTRTraceCategoryDraw,
+	// Frames of animated images decoded by BTRImageView.
+	BTRTraceCategoryImageFrameDecode,
+	// Display link updates handled by an animating BTRClipView.
+	BTRTraceCategoryDisplayLinkTick,
+	// Display link callbacks that fired before the previous update had been
+	// handled on the main thread, meaning the main thread is falling behind.
+	BTRTraceCategoryDroppedUpdate,
+	// Rebuilds of the hover tracking index.
+	BTRTraceCategoryTrackingRebuild,
+	
+	BTRTraceCategoryCount
+};
+
+// Runtime access to Butter's instrumentation.
+//
+// Counters are always collected and cost a single atomic increment. Timing spans
+// are only recorded between -startRecording and -stopRecording, into a bounded
+// buffer that keeps the most recent events.
+@interface BTRTrace : NSObject
+
+// The name used for the category in snapshots and exported traces.
++ (NSString *)nameForCategory:(BTRTraceCategory)category;
+
+// The number of times the category was hit since the last -resetCounters.
++ (uint64_t)countForCategory:(BTRTraceCategory)category;
+
+// Returns the current value of every counter, keyed by category name.
++ (NSDictionary *)counterSnapshot;
+
++ (void)resetCounters;
+
+// Discards previously recorded spans and starts recording new ones.
++ (void)startRecording;
++ (void)stopRecording;
++ (BOOL)isRecording;
+
+// The maximum number of spans kept while recording.
+//
+// Defaults to 65536.
++ (NSUInteger)maximumRecordedEventCount;
++ (void)setMaximumRecordedEventCount:(NSUInteger)count;
+
+// Returns the recorded spans and the current counters in the Chrome trace event
+// format, which can be loaded into chrome://tracing.
++ (NSData *)traceEventJSONData;
+
+// Writes the output of +traceEventJSONData to the file URL.
++ (BOOL)writeTraceEventJSONToURL:(NSURL *)url error:(NSError **)error;
+
+@end
@@ -0,0 +1,195 @@
+//
+//  BTRTrace.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRTrace.h"
+#import "BTRTraceInternal.h"
+#import <mach/mach_time.h>
+#import <pthread.h>
+#import <unistd.h>
+
+typedef struct {
+	const char *name;
+	BTRTraceCategory category;
+	uint64_t start;
+	uint64_t duration;
+	mach_port_t thread;
+} BTRTraceEvent;
+
+static uint64_t BTRTraceCounters[BTRTraceCategoryCount];
+
+// Recorded spans are kept in a ring buffer guarded by a mutex. Spans are ended
+// on render queue threads as well as the main thread, which a spin lock could
+// starve through priority inversion.
+static pthread_mutex_t BTRTraceLock = PTHREAD_MUTEX_INITIALIZER;
+static volatile bool BTRTraceRecording = false;
+static BTRTraceEvent *BTRTraceEvents = NULL;
+static NSUInteger BTRTraceEventCapacity = 65536;
+static NSUInteger BTRTraceEventCount = 0;
+static NSUInteger BTRTraceEventNext = 0;
+static uint64_t BTRTraceRecordingStart = 0;
+
+static NSString * const BTRTraceCategoryNames[BTRTraceCategoryCount] = {
+	[BTRTraceCategoryStateChange] = @"stateChange",
+	[BTRTraceCategoryLayout] = @"layout",
+	[BTRTraceCategoryLayoutApply] = @"layoutApply",
+	[BTRTraceCategoryDraw] = @"draw",
+	[BTRTraceCategoryImageFrameDecode] = @"imageFrameDecode",
+	[BTRTraceCategoryDisplayLinkTick] = @"displayLinkTick",
+	[BTRTraceCategoryDroppedUpdate] = @"droppedUpdate",
+	[BTRTraceCategoryTrackingRebuild] = @"trackingRebuild",
+};
+
+static double BTRTraceMicrosecondsFromAbsoluteTime(uint64_t time) {
+	static mach_timebase_info_data_t timebase;
+	if (timebase.denom == 0) mach_timebase_info(&timebase);
+	return (double)time * timebase.numer / timebase.denom / 1000.0;
+}
+
+#pragma mark Instrumentation
+
+#if BTR_TRACE_ENABLED
+
+void BTRTraceIncrementCounter(BTRTraceCategory category) {
+	__atomic_fetch_add(&BTRTraceCounters[category], 1, __ATOMIC_RELAXED);
+}
+
+BTRTraceSpan BTRTraceSpanBegin(BTRTraceCategory category, const char *name) {
+	__atomic_fetch_add(&BTRTraceCounters[category], 1, __ATOMIC_RELAXED);
+	return (BTRTraceSpan){ category, name, (BTRTraceRecording ? mach_absolute_time() : 0) };
+}
+
+void BTRTraceSpanEnd(BTRTraceSpan *span) {
+	if (span->start == 0 || !BTRTraceRecording) return;
+	
+	uint64_t end = mach_absolute_time();
+	mach_port_t thread = pthread_mach_thread_np(pthread_self());
+	
+	pthread_mutex_lock(&BTRTraceLock);
+	if (BTRTraceEvents != NULL && span->start >= BTRTraceRecordingStart) {
+		BTRTraceEvents[BTRTraceEventNext] = (BTRTraceEvent){ span->name, span->category, span->start, end - span->start, thread };
+		BTRTraceEventNext = (BTRTraceEventNext + 1) % BTRTraceEventCapacity;
+		BTRTraceEventCount = MIN(BTRTraceEventCount + 1, BTRTraceEventCapacity);
+	}
+	pthread_mutex_unlock(&BTRTraceLock);
+}
+
+#endif
+
+@implementation BTRTrace
+
+#pragma mark Counters
+
++ (NSString *)nameForCategory:(BTRTraceCategory)category {
+	NSParameterAssert(category < BTRTraceCategoryCount);
+	return BTRTraceCategoryNames[category];
+}
+
++ (uint64_t)countForCategory:(BTRTraceCategory)category {
+	NSParameterAssert(category < BTRTraceCategoryCount);
+	return __atomic_load_n(&BTRTraceCounters[category], __ATOMIC_RELAXED);
+}
+
++ (NSDictionary *)counterSnapshot {
+	NSMutableDictionary *snapshot = [NSMutableDictionary dictionaryWithCapacity:BTRTraceCategoryCount];
+	for (BTRTraceCategory category = 0; category < BTRTraceCategoryCount; category++) {
+		snapshot[BTRTraceCategoryNames[category]] = @([self countForCategory:category]);
+	}
+	return snapshot;
+}
+
++ (void)resetCounters {
+	for (BTRTraceCategory category = 0; category < BTRTraceCategoryCount; category++) {
+		__atomic_store_n(&BTRTraceCounters[category], 0, __ATOMIC_RELAXED);
+	}
+}
+
+#pragma mark Recording
+
++ (void)startRecording {
+	pthread_mutex_lock(&BTRTraceLock);
+	if (BTRTraceEvents == NULL) {
+		BTRTraceEvents = calloc(BTRTraceEventCapacity, sizeof(BTRTraceEvent));
+	}
+	BTRTraceEventCount = 0;
+	BTRTraceEventNext = 0;
+	BTRTraceRecordingStart = mach_absolute_time();
+	BTRTraceRecording = true;
+	pthread_mutex_unlock(&BTRTraceLock);
+}
+
++ (void)stopRecording {
+	BTRTraceRecording = false;
+}
+
++ (BOOL)isRecording {
+	return BTRTraceRecording;
+}
+
++ (NSUInteger)maximumRecordedEventCount {
+	return BTRTraceEventCapacity;
+}
+
++ (void)setMaximumRecordedEventCount:(NSUInteger)count {
+	count = MAX(count, 1);
+	pthread_mutex_lock(&BTRTraceLock);
+	BTRTraceEventCapacity = count;
+	free(BTRTraceEvents);
+	BTRTraceEvents = (BTRTraceRecording ? calloc(count, sizeof(BTRTraceEvent)) : NULL);
+	BTRTraceEventCount = 0;
+	BTRTraceEventNext = 0;
+	pthread_mutex_unlock(&BTRTraceLock);
+}
+
+#pragma mark Export
+
++ (NSData *)traceEventJSONData {
+	pthread_mutex_lock(&BTRTraceLock);
+	NSUInteger count = BTRTraceEventCount;
+	NSUInteger first = (BTRTraceEventNext + BTRTraceEventCapacity - count) % BTRTraceEventCapacity;
+	BTRTraceEvent *events = malloc(MAX(count, 1) * sizeof(BTRTraceEvent));
+	for (NSUInteger i = 0; i < count; i++) {
+		events[i] = BTRTraceEvents[(first + i) % BTRTraceEventCapacity];
+	}
+	uint64_t recordingStart = BTRTraceRecordingStart;
+	pthread_mutex_unlock(&BTRTraceLock);
+	
+	NSNumber *pid = @(getpid());
+	NSMutableArray *traceEvents = [NSMutableArray arrayWithCapacity:count + 1];
+	for (NSUInteger i = 0; i < count; i++) {
+		BTRTraceEvent event = events[i];
+		[traceEvents addObject:@{
+			@"name": @(event.name),
+			@"cat": BTRTraceCategoryNames[event.category],
+			@"ph": @"X",
+			@"ts": @(BTRTraceMicrosecondsFromAbsoluteTime(event.start - recordingStart)),
+			@"dur": @(BTRTraceMicrosecondsFromAbsoluteTime(event.duration)),
+			@"pid": pid,
+			@"tid": @(event.thread),
+		}];
+	}
+	free(events);
+	
+	// The counters are exported as a single sample taken at export time.
+	uint64_t now = mach_absolute_time();
+	[traceEvents addObject:@{
+		@"name": @"Butter counters",
+		@"ph": @"C",
+		@"ts": @(recordingStart > 0 ? BTRTraceMicrosecondsFromAbsoluteTime(now - recordingStart) : 0),
+		@"pid": pid,
+		@"args": [self counterSnapshot],
+	}];
+	
+	NSDictionary *trace = @{ @"traceEvents": traceEvents, @"displayTimeUnit": @"ms" };
+	return [NSJSONSerialization dataWithJSONObject:trace options:0 error:NULL];
+}
+
++ (BOOL)writeTraceEventJSONToURL:(NSURL *)url error:(NSError **)error {
+	return [[self traceEventJSONData] writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+@end
@@ -20,6 +20,10 @@
 
 // Whether the view's content and subviews masks to its bounds
 //
+// If the view has rounded corners but no subviews, its drawing is clipped to
+// the rounded bounds instead of using a layer mask, which would require an
+// offscreen rendering pass.
+//
 // Defaults to NO.
 @property (nonatomic, assign) BOOL masksToBounds;
 
@@ -31,6 +35,15 @@
 // Defaults to 0.
 @property (nonatomic, assign) CGFloat cornerRadius;
 
+// Whether the layer's shadowPath is kept in sync with the view's bounds and
+// `cornerRadius`. Without a shadow path, the shadow has to be derived from the
+// layer's rendered alpha in an offscreen pass.
+//
+// Disable this if the view casts a shadow that isn't shaped like its bounds.
+//
+// Defaults to YES.
+@property (nonatomic, assign) BOOL automaticallyUpdatesShadowPath;
+
 // Whether the view's drawing completely fills its bounds with opaque content.
 //
 // Defaults to NO.
@@ -58,8 +71,67 @@
 // The animation can be customized by wrapping the call in a NSView animation.
 - (void)displayAnimated;
 
-// TODO: Disabled due to an AppKit bug getting in the way. Will be implemented
-// in the future.
-//@property (nonatomic, copy) void (^drawRectBlock)(BTRView *view, CGContextRef ctx);
+// Called by BTRReusableViewPool when the view is returned to the pool, after it
+// has been removed from its superview. Subclasses should reset any per-use state
+// here, and must call super.
+//
+// The default implementation cancels any pending asynchronous display.
+- (void)prepareForReuse;
+
+// Whether the view's contents are rendered on a background queue.
+//
+// When enabled, -drawRect: is not called. Instead, `asynchronousDrawingBlock`
+// is invoked off the main thread with a bitmap context at the window's backing
+// scale, and the resulting image is committed as the layer's contents on the
+// main thread. If the view is invalidated again before a render completes, the
+// stale render is discarded.
+//
+// Defaults to NO.
+@property (nonatomic, assign) BOOL displaysAsynchronously;
+
+// The block used to draw the view's contents when `displaysAsynchronously` or
+// `usesTiledBacking` is enabled. `rect` is the part of the view to draw, in the
+// view's coordinate space: the bounds at the time the render was requested, or
+// a single tile. The context is already flipped if the view is flipped.
+//
+// The block is called on a background queue, and as such must not access the
+// view or any other main-thread-only state.
+@property (nonatomic, copy) void (^asynchronousDrawingBlock)(CGContextRef ctx, CGRect rect);
+
+// The maximum number of asynchronous renders that may be in flight at once,
+// shared between all views.
+//
+// Defaults to the number of active processors.
++ (NSInteger)maximumConcurrentAsynchronousDisplayCount;
++ (void)setMaximumConcurrentAsynchronousDisplayCount:(NSInteger)count;
+
+// Whether the view's contents are split into tiles of `tileSize`, which are
+// rendered asynchronously with `asynchronousDrawingBlock` as they become
+// visible. Intended for very large document views inside a BTRScrollView.
+//
+// Only the tiles in the enclosing clip view's visible rect and, while an
+// animated scroll is in progress, its destination rect are rendered. Calls to
+// -setNeedsDisplayInRect: only invalidate the tiles intersecting the rect,
+// while -setNeedsDisplay: invalidates every tile.
+//
+// Defaults to NO.
+@property (nonatomic, assign) BOOL usesTiledBacking;
+
+// The size of each tile when `usesTiledBacking` is enabled.
+//
+// Defaults to 256x256.
+@property (nonatomic, assign) CGSize tileSize;
+
+// The maximum number of rendered tiles kept in memory, including the tiles
+// that are not currently visible. The visible and prefetched tiles are always
+// kept, even if there are more of them.
+//
+// Defaults to 64.
+@property (nonatomic, assign) NSUInteger maximumCachedTileCount;
+
+// Debugging aid. Returns the number of layers belonging to Butter views in the
+// window that currently require an offscreen rendering pass, such as shadows
+// without a shadow path, mask layers, or rounded corners masking sublayers.
++ (NSUInteger)offscreenRenderedLayerCountInWindow:(NSWindow *)window;
 
 @end
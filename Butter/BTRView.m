@@ -7,10 +7,38 @@
 //
 
 #import "BTRView.h"
+#import "BTRClipView.h"
+#import "BTRGeometryAdditions.h"
+#import "BTRTextFieldProtocol.h"
+#import "BTRRenderQueue.h"
+#import "BTRTiledBacking.h"
+#import "BTRTraceInternal.h"
 #import <QuartzCore/QuartzCore.h>
 
 @implementation BTRView {
 	BOOL drawFlag;
+	
+	// Incremented on the main thread every time an asynchronous render is
+	// requested. Renders that complete with an older generation are discarded.
+	NSUInteger _displayGeneration;
+	__weak NSOperation *_pendingDisplayOperation;
+	
+	BTRTiledBacking *_tiledBacking;
+	__weak NSClipView *_observedClipView;
+	
+	BOOL _masksToBounds;
+	// Whether rounded corners are applied by clipping the view's drawing
+	// instead of masking the layer.
+	BOOL _roundsContents;
+	
+	// The size of the view when the current live resize started, and whether
+	// its rounded corners are used as cap insets until the resize ends.
+	NSSize _liveResizeStartSize;
+	BOOL _stretchesRoundedContents;
+	
+	// The bounds and corner radius the current shadow path was created with.
+	CGRect _shadowPathBounds;
+	CGFloat _shadowPathCornerRadius;
 }
 @synthesize flipped = _flipped;
 
@@ -59,11 +87,19 @@
 }
 
 static void BTRViewCommonInit(BTRView *self) {
+	self->_tileSize = CGSizeMake(256, 256);
+	self->_maximumCachedTileCount = 64;
+	self->_automaticallyUpdatesShadowPath = YES;
 	self.wantsLayer = YES;
 	self.layerContentsPlacement = NSViewLayerContentsPlacementScaleAxesIndependently;
 	self.layerContentsRedrawPolicy = NSViewLayerContentsRedrawOnSetNeedsDisplay;
 }
 
+- (void)dealloc {
+	[NSNotificationCenter.defaultCenter removeObserver:self];
+	[_tiledBacking tearDown];
+}
+
 #pragma mark NSObject
 
 - (NSString *)description {
@@ -86,14 +122,26 @@ static void BTRViewCommonInit(BTRView *self) {
 
 - (void)setCornerRadius:(CGFloat)radius {
 	self.layer.cornerRadius = radius;
+	[self updateCornerMasking];
+	[self updateShadowPath];
 }
 
 - (BOOL)masksToBounds {
-	return self.layer.masksToBounds;
+	return _masksToBounds;
 }
 
 - (void)setMasksToBounds:(BOOL)masksToBounds {
-	self.layer.masksToBounds = masksToBounds;
+	_masksToBounds = masksToBounds;
+	[self updateCornerMasking];
+}
+
+- (void)setAutomaticallyUpdatesShadowPath:(BOOL)automaticallyUpdatesShadowPath {
+	_automaticallyUpdatesShadowPath = automaticallyUpdatesShadowPath;
+	if (automaticallyUpdatesShadowPath) {
+		[self updateShadowPath];
+	} else {
+		self.layer.shadowPath = NULL;
+	}
 }
 
 - (BOOL)isOpaque {
@@ -104,14 +152,112 @@ static void BTRViewCommonInit(BTRView *self) {
 	self.layer.opaque = opaque;
 }
 
+#pragma mark Shadow and corner masking
+
+// Called on every layout, so the path is only recreated when its shape
+// changes.
+- (void)updateShadowPath {
+	if (!self.automaticallyUpdatesShadowPath) return;
+	CGRect bounds = self.bounds;
+	CGFloat radius = self.cornerRadius;
+	if (self.layer.shadowPath != NULL && CGRectEqualToRect(bounds, _shadowPathBounds) && radius == _shadowPathCornerRadius) return;
+	
+	CGPathRef path = BTRCGPathCreateWithRoundedRect(bounds, radius);
+	self.layer.shadowPath = path;
+	CGPathRelease(path);
+	_shadowPathBounds = bounds;
+	_shadowPathCornerRadius = radius;
+}
+
+// Masking the layer to rounded corners requires an offscreen pass. As long as
+// the view has no subviews, its own drawing is the only thing that needs to be
+// rounded, so it is clipped while drawing instead.
+- (void)updateCornerMasking {
+	[self updateCornerMaskingExcludingSubview:nil];
+}
+
+- (void)updateCornerMaskingExcludingSubview:(NSView *)excludedSubview {
+	NSArray *subviews = self.subviews;
+	NSUInteger subviewCount = subviews.count;
+	if (excludedSubview != nil && [subviews containsObject:excludedSubview]) {
+		subviewCount--;
+	}
+	
+	BOOL roundsContents = self.masksToBounds && self.layer.cornerRadius > 0 && subviewCount == 0 && !self.usesTiledBacking;
+	self.layer.masksToBounds = self.masksToBounds && !roundsContents;
+	
+	if (roundsContents || roundsContents != _roundsContents) {
+		_roundsContents = roundsContents;
+		// Tiles are never rounded, so their cached contents are still valid.
+		if (!self.usesTiledBacking) {
+			self.needsDisplay = YES;
+		}
+	}
+}
+
+- (void)didAddSubview:(NSView *)subview {
+	[super didAddSubview:subview];
+	[self updateCornerMasking];
+}
+
+- (void)willRemoveSubview:(NSView *)subview {
+	[super willRemoveSubview:subview];
+	[self updateCornerMaskingExcludingSubview:subview];
+}
+
+- (void)drawLayer:(CALayer *)layer inContext:(CGContextRef)ctx {
+	BTRTraceScope(BTRTraceCategoryDraw, "BTRView.drawRect");
+	if (_roundsContents && layer == self.layer) {
+		CGPathRef path = BTRCGPathCreateWithRoundedRect(layer.bounds, layer.cornerRadius);
+		CGContextAddPath(ctx, path);
+		CGContextClip(ctx);
+		CGPathRelease(path);
+	}
+	[super drawLayer:layer inContext:ctx];
+}
+
+#pragma mark Live resize
+
+// The contents drawn before the resize started are stretched until it ends,
+// instead of being redrawn for every intermediate size. If the corners are
+// part of those contents, they are used as cap insets so they keep their shape.
+- (void)viewWillStartLiveResize {
+	[super viewWillStartLiveResize];
+	_liveResizeStartSize = self.bounds.size;
+	
+	CGFloat radius = self.cornerRadius;
+	_stretchesRoundedContents = (_roundsContents && MIN(_liveResizeStartSize.width, _liveResizeStartSize.height) > 2 * radius);
+	if (_stretchesRoundedContents) {
+		self.layer.contentsCenter = BTRCAContentsCenterForInsets(NSEdgeInsetsMake(radius, radius, radius, radius), _liveResizeStartSize);
+	}
+}
+
+- (void)viewDidEndLiveResize {
+	[super viewDidEndLiveResize];
+	if (_stretchesRoundedContents) {
+		_stretchesRoundedContents = NO;
+		self.layer.contentsCenter = CGRectMake(0.0, 0.0, 1.0, 1.0);
+	}
+	
+	if (!NSEqualSizes(_liveResizeStartSize, self.bounds.size)) {
+		self.needsLayout = YES;
+		[self setNeedsDisplay:YES];
+	}
+}
+
 #pragma mark Drawing and actions
 
 - (void)displayAnimated {
-	drawFlag = self.animatesContents;
+	BOOL animatesContents = self.animatesContents;
 	self.animatesContents = YES;
+	drawFlag = animatesContents;
 	[self display];
 }
 
+- (void)prepareForReuse {
+	[self cancelAsynchronousDisplay];
+}
+
 - (void)setAnimatesContents:(BOOL)animate {
 	drawFlag = animate;
 	_animatesContents = animate;
@@ -159,16 +305,279 @@ static void BTRViewCommonInit(BTRView *self) {
     [super setNextResponder:newNextResponder];
 }
 
-#pragma mark Drawing block
+#pragma mark Asynchronous drawing
+
++ (NSInteger)maximumConcurrentAsynchronousDisplayCount {
+	return BTRRenderQueue().maxConcurrentOperationCount;
+}
+
++ (void)setMaximumConcurrentAsynchronousDisplayCount:(NSInteger)count {
+	BTRRenderQueue().maxConcurrentOperationCount = MAX(count, 1);
+}
+
+- (void)setDisplaysAsynchronously:(BOOL)displaysAsynchronously {
+	if (_displaysAsynchronously != displaysAsynchronously) {
+		_displaysAsynchronously = displaysAsynchronously;
+		[self cancelAsynchronousDisplay];
+		self.needsDisplay = YES;
+	}
+}
+
+- (void)setAsynchronousDrawingBlock:(void (^)(CGContextRef, CGRect))asynchronousDrawingBlock {
+	_asynchronousDrawingBlock = [asynchronousDrawingBlock copy];
+	self.needsDisplay = YES;
+}
+
+- (BOOL)wantsUpdateLayer {
+	return self.displaysAsynchronously || self.usesTiledBacking;
+}
+
+- (void)updateLayer {
+	// Tiles are rendered as part of layout instead.
+	if (self.usesTiledBacking) return;
+	[self displayAsynchronously];
+}
+
+- (void)viewDidChangeBackingProperties {
+	[super viewDidChangeBackingProperties];
+	if (self.usesTiledBacking) {
+		// Tiles are keyed by scale, so this is enough to render at the new scale.
+		self.needsLayout = YES;
+	} else if (self.displaysAsynchronously) {
+		self.needsDisplay = YES;
+	}
+}
+
+- (void)cancelAsynchronousDisplay {
+	_displayGeneration++;
+	[_pendingDisplayOperation cancel];
+	_pendingDisplayOperation = nil;
+}
 
-//- (void)drawRect:(NSRect)dirtyRect {
-//	[super drawRect:dirtyRect];
-//	
-//	if (self.drawRectBlock != nil) {
-//		NSLog(@"%s",__PRETTY_FUNCTION__);
-//		CGContextRef ctx = [[NSGraphicsContext currentContext] graphicsPort];
-//		self.drawRectBlock(self, ctx);
-//	}
-//}
+- (void)displayAsynchronously {
+	[self cancelAsynchronousDisplay];
+	
+	// -displayAnimated only enables `animatesContents` for a single display pass,
+	// but the new contents won't arrive until later. Capture the setting now and
+	// restore it the same way -actionForLayer:forKey: would.
+	NSTimeInterval crossfadeDuration = self.animatesContents ? NSAnimationContext.currentContext.duration : 0;
+	self.animatesContents = drawFlag;
+	
+	void (^drawingBlock)(CGContextRef, CGRect) = self.asynchronousDrawingBlock;
+	CGSize size = self.bounds.size;
+	if (drawingBlock == nil || size.width <= 0 || size.height <= 0) {
+		self.layer.contents = nil;
+		return;
+	}
+	
+	if (_roundsContents) {
+		void (^unclippedDrawingBlock)(CGContextRef, CGRect) = drawingBlock;
+		CGFloat radius = self.cornerRadius;
+		drawingBlock = ^(CGContextRef ctx, CGRect rect) {
+			CGPathRef path = BTRCGPathCreateWithRoundedRect(rect, radius);
+			CGContextAddPath(ctx, path);
+			CGContextClip(ctx);
+			CGPathRelease(path);
+			unclippedDrawingBlock(ctx, rect);
+		};
+	}
+	
+	CGFloat scale = self.window.backingScaleFactor ?: self.layer.contentsScale;
+	BOOL opaque = self.opaque;
+	BOOL flipped = self.flipped;
+	NSUInteger generation = _displayGeneration;
+	
+	// The view is only referenced weakly off the main thread so that it can never
+	// be deallocated on the render queue.
+	__weak BTRView *weakSelf = self;
+	NSBlockOperation *operation = [[NSBlockOperation alloc] init];
+	__weak NSBlockOperation *weakOperation = operation;
+	[operation addExecutionBlock:^{
+		if (weakOperation.isCancelled) return;
+		CGImageRef image = BTRRenderQueueCreateImage(size, scale, opaque, flipped, drawingBlock);
+		dispatch_async(dispatch_get_main_queue(), ^{
+			BTRView *strongSelf = weakSelf;
+			if (strongSelf != nil && strongSelf->_displayGeneration == generation) {
+				[strongSelf commitAsynchronousContents:(__bridge id)image scale:scale crossfadeDuration:crossfadeDuration];
+			}
+			CGImageRelease(image);
+		});
+	}];
+	
+	_pendingDisplayOperation = operation;
+	[BTRRenderQueue() addOperation:operation];
+}
+
+- (void)commitAsynchronousContents:(id)contents scale:(CGFloat)scale crossfadeDuration:(NSTimeInterval)duration {
+	_pendingDisplayOperation = nil;
+	
+	[CATransaction begin];
+	[CATransaction setDisableActions:YES];
+	if (duration > 0) {
+		CATransition *fade = [CATransition animation];
+		fade.type = kCATransitionFade;
+		fade.duration = duration;
+		[self.layer addAnimation:fade forKey:@"contents"];
+	}
+	self.layer.contentsScale = scale;
+	self.layer.contents = contents;
+	[CATransaction commit];
+}
+
+#pragma mark Tiled backing
+
+- (void)setUsesTiledBacking:(BOOL)usesTiledBacking {
+	if (_usesTiledBacking == usesTiledBacking) return;
+	_usesTiledBacking = usesTiledBacking;
+	
+	if (usesTiledBacking) {
+		[self cancelAsynchronousDisplay];
+		_tiledBacking = [[BTRTiledBacking alloc] initWithView:self];
+		_tiledBacking.tileSize = self.tileSize;
+		_tiledBacking.maximumCachedTileCount = self.maximumCachedTileCount;
+		self.layer.contents = nil;
+		// The view's own layer has no contents to redraw, so AppKit is kept
+		// from invalidating it (and with it every tile) on its own.
+		self.layerContentsRedrawPolicy = NSViewLayerContentsRedrawNever;
+	} else {
+		[_tiledBacking tearDown];
+		_tiledBacking = nil;
+		self.layerContentsRedrawPolicy = NSViewLayerContentsRedrawOnSetNeedsDisplay;
+	}
+	
+	[self updateClipViewObservation];
+	[self updateCornerMasking];
+	self.needsDisplay = YES;
+	self.needsLayout = YES;
+}
+
+- (void)setTileSize:(CGSize)tileSize {
+	_tileSize = tileSize;
+	_tiledBacking.tileSize = tileSize;
+	self.needsLayout = YES;
+}
+
+- (void)setMaximumCachedTileCount:(NSUInteger)count {
+	_maximumCachedTileCount = count;
+	_tiledBacking.maximumCachedTileCount = count;
+}
+
+- (void)setNeedsDisplay:(BOOL)flag {
+	if (self.usesTiledBacking) {
+		if (flag) {
+			[_tiledBacking setNeedsDisplay];
+			self.needsLayout = YES;
+		}
+		return;
+	}
+	[super setNeedsDisplay:flag];
+}
+
+- (void)setNeedsDisplayInRect:(NSRect)invalidRect {
+	if (self.usesTiledBacking) {
+		[_tiledBacking setNeedsDisplayInRect:invalidRect];
+		self.needsLayout = YES;
+		return;
+	}
+	[super setNeedsDisplayInRect:invalidRect];
+}
+
+- (void)setFrameSize:(NSSize)newSize {
+	NSSize oldSize = self.bounds.size;
+	[super setFrameSize:newSize];
+	if (NSEqualSizes(oldSize, self.bounds.size)) return;
+	
+	[self updateShadowPath];
+	if (self.usesTiledBacking) {
+		[_tiledBacking boundsSizeDidChangeFromSize:oldSize];
+		self.needsLayout = YES;
+	}
+}
+
+- (void)layout {
+	BTRTraceScope(BTRTraceCategoryLayout, "BTRView.layout");
+	[super layout];
+	[self updateShadowPath];
+	if (self.usesTiledBacking) {
+		[self updateTiles];
+	}
+}
+
+- (void)updateTiles {
+	// While a BTRClipView is animating, prefetch the tiles at the destination
+	// so they are ready by the time the animation settles.
+	CGRect prefetchRect = CGRectNull;
+	BTRClipView *clipView = (BTRClipView *)self.enclosingScrollView.contentView;
+	if ([clipView isKindOfClass:BTRClipView.class] && clipView.documentView != nil) {
+		prefetchRect = [clipView.documentView convertRect:clipView.destinationDocumentVisibleRect toView:self];
+	}
+	[_tiledBacking updateTilesWithVisibleRect:self.visibleRect prefetchRect:prefetchRect];
+}
+
+- (void)viewDidMoveToSuperview {
+	[super viewDidMoveToSuperview];
+	[self updateClipViewObservation];
+}
+
+- (void)viewDidMoveToWindow {
+	[super viewDidMoveToWindow];
+	[self updateClipViewObservation];
+}
+
+// Scrolling doesn't trigger layout of the document view, so the visible
+// tiles are updated whenever the enclosing clip view's bounds change.
+- (void)updateClipViewObservation {
+	NSClipView *clipView = self.usesTiledBacking ? self.enclosingScrollView.contentView : nil;
+	if (clipView == _observedClipView) return;
+	
+	NSNotificationCenter *nc = NSNotificationCenter.defaultCenter;
+	if (_observedClipView != nil) {
+		[nc removeObserver:self name:NSViewBoundsDidChangeNotification object:_observedClipView];
+	}
+	_observedClipView = clipView;
+	if (clipView != nil) {
+		clipView.postsBoundsChangedNotifications = YES;
+		[nc addObserver:self selector:@selector(clipViewBoundsDidChange:) name:NSViewBoundsDidChangeNotification object:clipView];
+	}
+}
+
+- (void)clipViewBoundsDidChange:(NSNotification *)notification {
+	[self updateTiles];
+}
+
+#pragma mark Debugging
+
+static BOOL BTRLayerRequiresOffscreenRendering(CALayer *layer) {
+	if (layer.mask != nil || layer.shouldRasterize) return YES;
+	if (layer.shadowOpacity > 0 && layer.shadowPath == NULL) return YES;
+	return (layer.masksToBounds && layer.cornerRadius > 0 && (layer.sublayers.count > 0 || layer.contents != nil));
+}
+
+// Counts the layer and its sublayers, stopping at the layers of other views.
+static NSUInteger BTRCountOffscreenRenderedLayers(CALayer *layer, BOOL isRoot) {
+	if (!isRoot && [layer.delegate isKindOfClass:NSView.class]) return 0;
+	NSUInteger count = BTRLayerRequiresOffscreenRendering(layer) ? 1 : 0;
+	for (CALayer *sublayer in layer.sublayers) {
+		count += BTRCountOffscreenRenderedLayers(sublayer, NO);
+	}
+	return count;
+}
+
+static NSUInteger BTRCountOffscreenRenderedLayersInView(NSView *view) {
+	NSUInteger count = 0;
+	BOOL isButterView = [view isKindOfClass:BTRView.class] || [view conformsToProtocol:@protocol(BTRTextField)];
+	if (isButterView && view.layer != nil) {
+		count += BTRCountOffscreenRenderedLayers(view.layer, YES);
+	}
+	for (NSView *subview in view.subviews) {
+		count += BTRCountOffscreenRenderedLayersInView(subview);
+	}
+	return count;
+}
+
++ (NSUInteger)offscreenRenderedLayerCountInWindow:(NSWindow *)window {
+	NSView *rootView = window.contentView.superview ?: window.contentView;
+	return BTRCountOffscreenRenderedLayersInView(rootView);
+}
 
 @end
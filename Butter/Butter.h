@@ -8,12 +8,15 @@
 
 #import <Butter/BTRImageView.h>
 #import <Butter/BTRControl.h>
+#import <Butter/BTRControlLayout.h>
 #import <Butter/BTRActivityIndicator.h>
 #import <Butter/BTRButton.h>
 #import <Butter/BTRTextField.h>
 #import <Butter/BTRSecureTextField.h>
 #import <Butter/BTRLabel.h>
 #import <Butter/BTRScrollView.h>
+#import <Butter/BTRReusableViewPool.h>
+#import <Butter/BTRTrace.h>
 #import <Butter/BTRClipView.h>
 #import <Butter/NSView+BTRAdditions.h>
 #import <Butter/NSImage+BTRImageAdditions.h>
@@ -0,0 +1,121 @@
+//
+//  BTRCoreControl.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRCoreControl.h"
+#include <math.h>
+#include <stdlib.h>
+
+BTRCoreControlState BTRCoreControlStateResolve(bool enabled, bool highlighted, bool mouseInside, bool selected) {
+	if (!enabled) return BTRCoreControlStateDisabled;
+	
+	BTRCoreControlState state = BTRCoreControlStateNormal;
+	if (highlighted) state |= mouseInside ? BTRCoreControlStateHighlighted : BTRCoreControlStateHover;
+	if (selected) state |= BTRCoreControlStateSelected;
+	return state;
+}
+
+// Continuous events
+
+static uint32_t BTRCoreContinuousEventsAddTransition(uint32_t pending, uint32_t event, uint32_t opposite) {
+	if (pending & opposite) return pending & ~opposite;
+	return pending | event;
+}
+
+uint32_t BTRCoreContinuousEventsCoalesce(uint32_t pending, uint32_t events) {
+	const uint32_t enter = BTRCoreControlEventMouseDragEnter;
+	const uint32_t exit = BTRCoreControlEventMouseDragExit;
+	pending |= events & ~(enter | exit);
+	if (events & enter) pending = BTRCoreContinuousEventsAddTransition(pending, enter, exit);
+	if (events & exit) pending = BTRCoreContinuousEventsAddTransition(pending, exit, enter);
+	return pending;
+}
+
+// Actions
+
+void BTRCoreActionListInit(BTRCoreActionList *list) {
+	list->events = NULL;
+	list->count = 0;
+	list->capacity = 0;
+	list->combinedEvents = 0;
+}
+
+void BTRCoreActionListDestroy(BTRCoreActionList *list) {
+	free(list->events);
+	BTRCoreActionListInit(list);
+}
+
+bool BTRCoreActionListAppend(BTRCoreActionList *list, uint32_t events) {
+	if (list->count == list->capacity) {
+		size_t capacity = (list->capacity > 0 ? list->capacity * 2 : 4);
+		uint32_t *storage = realloc(list->events, capacity * sizeof(uint32_t));
+		if (storage == NULL) return false;
+		list->events = storage;
+		list->capacity = capacity;
+	}
+	list->events[list->count++] = events;
+	list->combinedEvents |= events;
+	return true;
+}
+
+void BTRCoreActionListRemoveAll(BTRCoreActionList *list) {
+	list->count = 0;
+	list->combinedEvents = 0;
+}
+
+size_t BTRCoreActionListDispatch(const BTRCoreActionList *list, uint32_t events, BTRCoreActionCallback callback, void *context) {
+	if ((list->combinedEvents & events) == 0) return 0;
+	
+	size_t dispatched = 0;
+	// Actions added by a callback aren't called until the next dispatch, and a
+	// callback may also remove every action.
+	size_t count = list->count;
+	for (size_t i = 0; i < count && i < list->count; i++) {
+		if (list->events[i] & events) {
+			callback(i, events, context);
+			dispatched++;
+		}
+	}
+	return dispatched;
+}
+
+// Layout
+//
+// The single precision rounding matches the AppKit implementation this was
+// extracted from, so that frames stay pixel-identical.
+
+BTRCoreRect BTRCorePopUpButtonImageFrame(BTRCoreRect bounds, double imageWidth, double imageHeight, double edgeInset) {
+	double midY = bounds.y + bounds.height / 2;
+	return (BTRCoreRect){ edgeInset, roundf((float)(midY - imageHeight / 2)), imageWidth, imageHeight };
+}
+
+BTRCoreRect BTRCorePopUpButtonArrowFrame(BTRCoreRect bounds, double arrowWidth, double arrowHeight, double edgeInset) {
+	double midY = bounds.y + bounds.height / 2;
+	return (BTRCoreRect){ bounds.x + bounds.width - arrowWidth - edgeInset, roundf((float)(midY - arrowHeight / 2)), arrowWidth, arrowHeight };
+}
+
+BTRCoreRect BTRCorePopUpButtonLabelFrame(BTRCoreRect bounds, BTRCoreRect imageFrame, BTRCoreRect arrowFrame, double titleWidth, BTRCoreTextAlignment alignment, double edgeInset, double spacing) {
+	double maximumWidth = bounds.width - (imageFrame.x + imageFrame.width) - arrowFrame.width - edgeInset;
+	if (imageFrame.width != 0) maximumWidth -= spacing;
+	if (arrowFrame.width != 0) maximumWidth -= spacing;
+	
+	double width = fminf((float)titleWidth, (float)maximumWidth);
+	double x;
+	switch (alignment) {
+		case BTRCoreTextAlignmentRight:
+			x = arrowFrame.x - spacing - width;
+			break;
+		case BTRCoreTextAlignmentCenter:
+			x = floorf((float)(bounds.x + bounds.width / 2 - width / 2));
+			break;
+		case BTRCoreTextAlignmentLeft:
+		default:
+			x = imageFrame.x + imageFrame.width + spacing;
+			break;
+	}
+	return (BTRCoreRect){ x, 0, width, bounds.height };
+}
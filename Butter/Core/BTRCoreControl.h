@@ -0,0 +1,99 @@
+//
+//  BTRCoreControl.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// Portable control logic shared by BTRControl and the benchmark suite. This
+// header must not depend on AppKit or Foundation.
+
+#ifndef BTR_CORE_CONTROL_H
+#define BTR_CORE_CONTROL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "BTRCoreGeometry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Mirrors BTRControlState.
+typedef uint32_t BTRCoreControlState;
+enum {
+	BTRCoreControlStateNormal		= 0,
+	BTRCoreControlStateHighlighted	= 1 << 0,
+	BTRCoreControlStateDisabled		= 1 << 1,
+	BTRCoreControlStateSelected		= 1 << 2,
+	BTRCoreControlStateHover		= 1 << 3
+};
+
+// Mirrors the continuous BTRControlEvents that cancel each other out.
+enum {
+	BTRCoreControlEventMouseDragEnter	= 1 << 1,
+	BTRCoreControlEventMouseDragExit	= 1 << 2
+};
+
+// Adds continuous events to those pending delivery and returns the result.
+// Opposing events are coalesced to their net transition: a drag exit cancels a
+// pending drag enter and vice versa, so that at most one of them is pending,
+// and only if the mouse ended up on the other side of the control's bounds.
+uint32_t BTRCoreContinuousEventsCoalesce(uint32_t pending, uint32_t events);
+
+// Returns the state of a control from its flags. A highlighted control is only
+// in the highlighted state while the mouse is inside it, and hovered otherwise.
+BTRCoreControlState BTRCoreControlStateResolve(bool enabled, bool highlighted, bool mouseInside, bool selected);
+
+// The event masks of a control's actions, stored contiguously in the order the
+// actions were added so that dispatch doesn't have to touch the actions that
+// don't match.
+typedef struct {
+	uint32_t *events;
+	size_t count;
+	size_t capacity;
+	// The union of all masks in the list.
+	uint32_t combinedEvents;
+} BTRCoreActionList;
+
+void BTRCoreActionListInit(BTRCoreActionList *list);
+void BTRCoreActionListDestroy(BTRCoreActionList *list);
+
+// Appends the mask of a new action. Returns false if memory could not be allocated.
+bool BTRCoreActionListAppend(BTRCoreActionList *list, uint32_t events);
+
+// Removes all masks, keeping the storage for reuse.
+void BTRCoreActionListRemoveAll(BTRCoreActionList *list);
+
+typedef void (*BTRCoreActionCallback)(size_t index, uint32_t events, void *context);
+
+// Calls `callback` with the index of each action whose mask intersects `events`,
+// in order. Returns the number of actions called.
+size_t BTRCoreActionListDispatch(const BTRCoreActionList *list, uint32_t events, BTRCoreActionCallback callback, void *context);
+
+// Layout
+
+// Mirrors the NSTextAlignment values a BTRPopUpButton can lay out.
+typedef enum {
+	BTRCoreTextAlignmentLeft,
+	BTRCoreTextAlignmentRight,
+	BTRCoreTextAlignmentCenter
+} BTRCoreTextAlignment;
+
+// The frames of a BTRPopUpButton's image and arrow, sized to their images and
+// centered vertically, inset from the leading and trailing edges respectively.
+BTRCoreRect BTRCorePopUpButtonImageFrame(BTRCoreRect bounds, double imageWidth, double imageHeight, double edgeInset);
+BTRCoreRect BTRCorePopUpButtonArrowFrame(BTRCoreRect bounds, double arrowWidth, double arrowHeight, double edgeInset);
+
+// The frame of a BTRPopUpButton's label, placed between the image and arrow
+// frames according to the alignment, and narrowed to fit between them. The
+// image and arrow frames may have been replaced by subclassing hooks.
+BTRCoreRect BTRCorePopUpButtonLabelFrame(BTRCoreRect bounds, BTRCoreRect imageFrame, BTRCoreRect arrowFrame, double titleWidth, BTRCoreTextAlignment alignment, double edgeInset, double spacing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+//
+//  BTRCoreFrameScheduler.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRCoreFrameScheduler.h"
+#include <stdlib.h>
+
+typedef struct {
+	BTRCoreFrameCallback callback;
+	void *context;
+} BTRCoreFrameEntry;
+
+typedef struct {
+	BTRCoreFrameEntry *entries;
+	size_t count;
+	size_t capacity;
+} BTRCoreFrameQueue;
+
+struct BTRCoreFrameScheduler {
+	BTRCoreFrameQueue pending;
+	// The queue being fired. Swapped with `pending` so that neither has to be
+	// reallocated in the steady state.
+	BTRCoreFrameQueue firing;
+	// Set by the frame clock and cleared once the frame has been fired.
+	int frameInFlight;
+};
+
+BTRCoreFrameScheduler *BTRCoreFrameSchedulerCreate(void) {
+	return calloc(1, sizeof(BTRCoreFrameScheduler));
+}
+
+void BTRCoreFrameSchedulerDestroy(BTRCoreFrameScheduler *scheduler) {
+	if (scheduler == NULL) return;
+	free(scheduler->pending.entries);
+	free(scheduler->firing.entries);
+	free(scheduler);
+}
+
+bool BTRCoreFrameSchedulerSchedule(BTRCoreFrameScheduler *scheduler, BTRCoreFrameCallback callback, void *context, bool *wasIdle) {
+	BTRCoreFrameQueue *queue = &scheduler->pending;
+	if (queue->count == queue->capacity) {
+		size_t capacity = (queue->capacity > 0 ? queue->capacity * 2 : 8);
+		BTRCoreFrameEntry *entries = realloc(queue->entries, capacity * sizeof(BTRCoreFrameEntry));
+		if (entries == NULL) return false;
+		queue->entries = entries;
+		queue->capacity = capacity;
+	}
+	
+	if (wasIdle != NULL) *wasIdle = (queue->count == 0);
+	queue->entries[queue->count++] = (BTRCoreFrameEntry){ callback, context };
+	return true;
+}
+
+bool BTRCoreFrameSchedulerBeginFrame(BTRCoreFrameScheduler *scheduler) {
+	return __atomic_exchange_n(&scheduler->frameInFlight, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+bool BTRCoreFrameSchedulerFire(BTRCoreFrameScheduler *scheduler, double timestamp) {
+	__atomic_store_n(&scheduler->frameInFlight, 0, __ATOMIC_RELEASE);
+	
+	BTRCoreFrameQueue firing = scheduler->pending;
+	scheduler->pending = scheduler->firing;
+	scheduler->pending.count = 0;
+	
+	for (size_t i = 0; i < firing.count; i++) {
+		firing.entries[i].callback(timestamp, firing.entries[i].context);
+	}
+	
+	firing.count = 0;
+	scheduler->firing = firing;
+	return scheduler->pending.count > 0;
+}
+
+size_t BTRCoreFrameSchedulerGetPendingCount(const BTRCoreFrameScheduler *scheduler) {
+	return scheduler->pending.count;
+}
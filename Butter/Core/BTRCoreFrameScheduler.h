@@ -0,0 +1,52 @@
+//
+//  BTRCoreFrameScheduler.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// The bookkeeping behind BTRFrameScheduler, independent of the clock that
+// drives it.
+
+#ifndef BTR_CORE_FRAME_SCHEDULER_H
+#define BTR_CORE_FRAME_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*BTRCoreFrameCallback)(double timestamp, void *context);
+
+typedef struct BTRCoreFrameScheduler BTRCoreFrameScheduler;
+
+BTRCoreFrameScheduler *BTRCoreFrameSchedulerCreate(void);
+
+// Pending callbacks are discarded without being called.
+void BTRCoreFrameSchedulerDestroy(BTRCoreFrameScheduler *scheduler);
+
+// Schedules a callback for the next frame. `wasIdle` is set to whether no
+// callbacks were pending before, in which case the caller needs to start its
+// frame clock. Returns false if memory could not be allocated.
+bool BTRCoreFrameSchedulerSchedule(BTRCoreFrameScheduler *scheduler, BTRCoreFrameCallback callback, void *context, bool *wasIdle);
+
+// Called by the frame clock, on any thread, when a new frame begins. Returns
+// false if the previous frame hasn't been fired yet, in which case this frame
+// should be skipped instead of queueing up behind it.
+bool BTRCoreFrameSchedulerBeginFrame(BTRCoreFrameScheduler *scheduler);
+
+// Calls the callbacks that were pending when it was called. Callbacks scheduled
+// while firing are called on the following frame. Returns true if callbacks are
+// still pending, in which case the frame clock should keep running.
+bool BTRCoreFrameSchedulerFire(BTRCoreFrameScheduler *scheduler, double timestamp);
+
+size_t BTRCoreFrameSchedulerGetPendingCount(const BTRCoreFrameScheduler *scheduler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
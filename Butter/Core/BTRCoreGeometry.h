@@ -0,0 +1,27 @@
+//
+//  BTRCoreGeometry.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// Geometry types shared by the portable cores, laid out like their CoreGraphics
+// and AppKit counterparts.
+
+#ifndef BTR_CORE_GEOMETRY_H
+#define BTR_CORE_GEOMETRY_H
+
+typedef struct {
+	double x, y;
+} BTRCorePoint;
+
+typedef struct {
+	double x, y, width, height;
+} BTRCoreRect;
+
+typedef struct {
+	double top, left, bottom, right;
+} BTRCoreEdgeInsets;
+
+#endif
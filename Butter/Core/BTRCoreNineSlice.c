@@ -0,0 +1,57 @@
+//
+//  BTRCoreNineSlice.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRCoreNineSlice.h"
+#include <math.h>
+
+BTRCoreRect BTRCoreNineSliceContentsCenter(BTRCoreEdgeInsets insets, double imageWidth, double imageHeight) {
+	BTRCoreRect rect = { insets.left, insets.top, imageWidth - insets.left - insets.right, imageHeight - insets.top - insets.bottom };
+	if (rect.width > 0) {
+		rect.x /= imageWidth;
+		rect.width /= imageWidth;
+	}
+	if (rect.height > 0) {
+		rect.y /= imageHeight;
+		rect.height /= imageHeight;
+	}
+	return rect;
+}
+
+void BTRCoreNineSliceSegments(double length, double leadingCap, double trailingCap, double segments[4]) {
+	leadingCap = fmax(leadingCap, 0);
+	trailingCap = fmax(trailingCap, 0);
+	double caps = leadingCap + trailingCap;
+	if (caps > length && caps > 0) {
+		leadingCap *= length / caps;
+		trailingCap *= length / caps;
+	}
+	segments[0] = 0;
+	segments[1] = leadingCap;
+	segments[2] = length - trailingCap;
+	segments[3] = length;
+}
+
+void BTRCoreNineSliceLayout(double imageWidth, double imageHeight, BTRCoreEdgeInsets insets, BTRCoreRect destination, BTRCoreRect sourceRects[9], BTRCoreRect destinationRects[9]) {
+	double srcX[4], srcY[4], dstX[4], dstY[4];
+	BTRCoreNineSliceSegments(imageWidth, insets.left, insets.right, srcX);
+	BTRCoreNineSliceSegments(imageHeight, insets.top, insets.bottom, srcY);
+	BTRCoreNineSliceSegments(destination.width, insets.left, insets.right, dstX);
+	BTRCoreNineSliceSegments(destination.height, insets.top, insets.bottom, dstY);
+	
+	for (int row = 0; row < 3; row++) {
+		for (int column = 0; column < 3; column++) {
+			BTRCoreRect src = { srcX[column], srcY[row], srcX[column + 1] - srcX[column], srcY[row + 1] - srcY[row] };
+			BTRCoreRect dst = { destination.x + dstX[column], destination.y + dstY[row], dstX[column + 1] - dstX[column], dstY[row + 1] - dstY[row] };
+			if (src.width <= 0 || src.height <= 0 || dst.width <= 0 || dst.height <= 0) {
+				src.width = src.height = dst.width = dst.height = 0;
+			}
+			sourceRects[row * 3 + column] = src;
+			destinationRects[row * 3 + column] = dst;
+		}
+	}
+}
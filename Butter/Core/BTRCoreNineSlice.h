@@ -0,0 +1,40 @@
+//
+//  BTRCoreNineSlice.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// Portable geometry for stretchable images with cap insets, as displayed by
+// BTRImageView for a BTRImage.
+
+#ifndef BTR_CORE_NINE_SLICE_H
+#define BTR_CORE_NINE_SLICE_H
+
+#include "BTRCoreGeometry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the stretchable center of an image of the given size, in the unit
+// coordinate space used by CALayer's contentsCenter. BTRCAContentsCenterForInsets
+// wraps this for AppKit geometry.
+BTRCoreRect BTRCoreNineSliceContentsCenter(BTRCoreEdgeInsets insets, double imageWidth, double imageHeight);
+
+// Splits a length into the offsets of its two caps and the stretched center
+// between them, shrinking the caps proportionally if they don't fit.
+void BTRCoreNineSliceSegments(double length, double leadingCap, double trailingCap, double segments[4]);
+
+// Computes the nine source rects of an image and the destination rects they are
+// drawn into to fill `destination`, ordered row by row from the top left. The
+// caps are scaled down proportionally if the destination is smaller than the
+// insets. Slices with an empty source or destination have a zero size.
+void BTRCoreNineSliceLayout(double imageWidth, double imageHeight, BTRCoreEdgeInsets insets, BTRCoreRect destination, BTRCoreRect sourceRects[9], BTRCoreRect destinationRects[9]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
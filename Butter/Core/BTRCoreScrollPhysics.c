@@ -0,0 +1,19 @@
+//
+//  BTRCoreScrollPhysics.c
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRCoreScrollPhysics.h"
+#include <math.h>
+
+const double BTRCoreScrollSettleThreshold = 0.1;
+
+bool BTRCoreScrollStep(BTRCorePoint *origin, BTRCorePoint destination, double decelerationRate) {
+	BTRCorePoint lastOrigin = *origin;
+	origin->x = origin->x * decelerationRate + destination.x * (1 - decelerationRate);
+	origin->y = origin->y * decelerationRate + destination.y * (1 - decelerationRate);
+	return (fabs(origin->x - lastOrigin.x) < BTRCoreScrollSettleThreshold && fabs(origin->y - lastOrigin.y) < BTRCoreScrollSettleThreshold);
+}
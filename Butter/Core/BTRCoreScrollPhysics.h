@@ -0,0 +1,33 @@
+//
+//  BTRCoreScrollPhysics.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+// The animation curve BTRClipView uses for animated scrolling.
+
+#ifndef BTR_CORE_SCROLL_PHYSICS_H
+#define BTR_CORE_SCROLL_PHYSICS_H
+
+#include <stdbool.h>
+#include "BTRCoreGeometry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The distance, in points, under which a frame's movement ends the animation.
+extern const double BTRCoreScrollSettleThreshold;
+
+// Advances an animated scroll by one frame along an ease-out curve, moving the
+// origin towards the destination by `1 - decelerationRate` of the remaining
+// distance. Returns true once the origin has settled.
+bool BTRCoreScrollStep(BTRCorePoint *origin, BTRCorePoint destination, double decelerationRate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
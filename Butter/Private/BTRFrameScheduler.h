@@ -0,0 +1,24 @@
+//
+//  BTRFrameScheduler.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Runs blocks on the main thread once per display refresh.
+//
+// The underlying display link only runs while blocks are scheduled, and is
+// stopped after the first frame with no work.
+@interface BTRFrameScheduler : NSObject
+
++ (instancetype)sharedScheduler;
+
+// Schedules the block to be called on the main thread at the next display
+// refresh, with the time (in the same time base as NSEvent timestamps) of
+// the frame being prepared. Each block is called once.
+- (void)scheduleBlockForNextFrame:(void (^)(NSTimeInterval frameTimestamp))block;
+
+@end
@@ -0,0 +1,99 @@
+//
+//  BTRFrameScheduler.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRFrameScheduler.h"
+#import "BTRCoreFrameScheduler.h"
+#import <QuartzCore/QuartzCore.h>
+
+// Used if a display link can't be created, e.g. when no display is attached.
+static const NSTimeInterval BTRFrameSchedulerFallbackInterval = 1.0 / 60.0;
+
+@implementation BTRFrameScheduler {
+	CVDisplayLinkRef _displayLink;
+	// Tracks the pending blocks and whether a frame is in flight, so that slow
+	// frames don't queue up callbacks.
+	BTRCoreFrameScheduler *_scheduler;
+}
+
++ (instancetype)sharedScheduler {
+	static BTRFrameScheduler *scheduler = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		scheduler = [[self alloc] init];
+	});
+	return scheduler;
+}
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+	
+	_scheduler = BTRCoreFrameSchedulerCreate();
+	if (CVDisplayLinkCreateWithActiveCGDisplays(&_displayLink) == kCVReturnSuccess) {
+		CVDisplayLinkSetOutputCallback(_displayLink, &BTRFrameSchedulerCallback, (__bridge void *)self);
+	} else {
+		_displayLink = NULL;
+	}
+	
+	return self;
+}
+
+- (void)dealloc {
+	if (_displayLink != NULL) {
+		CVDisplayLinkStop(_displayLink);
+		CVDisplayLinkRelease(_displayLink);
+	}
+	BTRCoreFrameSchedulerDestroy(_scheduler);
+}
+
+static CVReturn BTRFrameSchedulerCallback(CVDisplayLinkRef displayLink, const CVTimeStamp *now, const CVTimeStamp *outputTime, CVOptionFlags flagsIn, CVOptionFlags *flagsOut, void *context) {
+	BTRFrameScheduler *scheduler = (__bridge BTRFrameScheduler *)context;
+	if (!BTRCoreFrameSchedulerBeginFrame(scheduler->_scheduler)) return kCVReturnSuccess;
+	
+	NSTimeInterval frameTimestamp = (NSTimeInterval)outputTime->hostTime / CVGetHostClockFrequency();
+	dispatch_async(dispatch_get_main_queue(), ^{
+		[scheduler fireWithTimestamp:frameTimestamp];
+	});
+	return kCVReturnSuccess;
+}
+
+// Balances the retain in -scheduleBlockForNextFrame:.
+static void BTRFrameSchedulerInvokeBlock(double timestamp, void *context) {
+	void (^block)(NSTimeInterval) = CFBridgingRelease(context);
+	block(timestamp);
+}
+
+- (void)scheduleBlockForNextFrame:(void (^)(NSTimeInterval))block {
+	NSParameterAssert(block);
+	bool wasIdle = false;
+	void *context = (void *)CFBridgingRetain([block copy]);
+	if (!BTRCoreFrameSchedulerSchedule(_scheduler, &BTRFrameSchedulerInvokeBlock, context, &wasIdle)) {
+		CFRelease(context);
+		return;
+	}
+	
+	if (_displayLink == NULL) {
+		if (wasIdle) {
+			dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(BTRFrameSchedulerFallbackInterval * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+				[self fireWithTimestamp:NSProcessInfo.processInfo.systemUptime];
+			});
+		}
+	} else if (!CVDisplayLinkIsRunning(_displayLink)) {
+		CVDisplayLinkStart(_displayLink);
+	}
+}
+
+- (void)fireWithTimestamp:(NSTimeInterval)frameTimestamp {
+	// Blocks scheduled while firing run on the following frame.
+	BOOL hasPendingBlocks = BTRCoreFrameSchedulerFire(_scheduler, frameTimestamp);
+	if (!hasPendingBlocks && _displayLink != NULL) {
+		CVDisplayLinkStop(_displayLink);
+	}
+}
+
+@end
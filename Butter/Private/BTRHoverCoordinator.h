@@ -0,0 +1,51 @@
+//
+//  BTRHoverCoordinator.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+
+// Tracks the mouse for every Butter control in a window using a single
+// tracking area on the window's content view, instead of one tracking
+// area per control.
+//
+// Registered views are kept in a uniform grid of their visible rects in
+// window coordinates. Mouse moved and dragged events are hit-tested against
+// the grid, and registered views receive -mouseEntered: and -mouseExited:
+// as the mouse crosses their visible rects, exactly as they would from
+// their own tracking areas.
+//
+// Views are re-indexed when their own frame or the frame of one of their
+// ancestors changes, or when an enclosing clip view scrolls. Bounds changed
+// notifications are turned on for those clip views as views register. While the window is in a live resize, the index isn't
+// updated until the resize ends.
+@interface BTRHoverCoordinator : NSObject
+
+// Returns the coordinator for the window, creating it if needed.
++ (instancetype)coordinatorForWindow:(NSWindow *)window;
+
+// Adds the view to the index. If the mouse is already inside the view, it
+// will receive -mouseEntered: shortly after.
+- (void)registerView:(NSView *)view;
+
+// Removes the view from the index without sending -mouseExited:.
+- (void)unregisterView:(NSView *)view;
+
+@end
+
+// Adopted by Butter views which track hover through the coordinator.
+@interface NSView (BTRHoverCoordinator)
+
+// Registers the view with the coordinator of its window if `tracksHover` is
+// YES, and unregisters it otherwise. Must be called again from
+// -viewDidMoveToWindow.
+- (void)btr_setTracksHover:(BOOL)tracksHover;
+
+// Unregisters the view from the coordinator of its current window if it is
+// moving to a different window. Must be called from -viewWillMoveToWindow:.
+- (void)btr_hoverViewWillMoveToWindow:(NSWindow *)newWindow;
+
+@end
@@ -0,0 +1,357 @@
+//
+//  BTRHoverCoordinator.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRHoverCoordinator.h"
+#import "BTRTraceInternal.h"
+#import <objc/runtime.h>
+
+// The edge length of each cell in the grid, in window points.
+static const CGFloat BTRHoverCoordinatorCellSize = 64.f;
+
+static void *BTRHoverCoordinatorKey = &BTRHoverCoordinatorKey;
+
+@interface BTRHoverCoordinator ()
+@property (nonatomic, weak) NSWindow *window;
+@property (nonatomic, strong) NSTrackingArea *trackingArea;
+// The view the tracking area is installed on.
+@property (nonatomic, weak) NSView *trackingView;
+@property (nonatomic, strong) id dragMonitor;
+@end
+
+@implementation BTRHoverCoordinator {
+	// Cell index -> views whose indexed rect intersects the cell.
+	NSMutableDictionary *_cells;
+	// View -> rect in window coordinates that the view is indexed under.
+	NSMapTable *_indexedRects;
+	// Views whose frame has changed since they were last indexed.
+	NSHashTable *_dirtyViews;
+	// Observed view -> registered views whose indexed rect depends on its
+	// geometry, which are the view itself and the views inside it.
+	NSMapTable *_dependentViews;
+	// Registered view -> the observed views it depends on.
+	NSMapTable *_dependencies;
+	NSHashTable *_hoveredViews;
+	BOOL _needsFullReindex;
+	BOOL _refreshScheduled;
+}
+
+// Returns the coordinator of the window without creating one.
+static BTRHoverCoordinator *BTRHoverCoordinatorForWindow(NSWindow *window) {
+	return (window != nil ? objc_getAssociatedObject(window, BTRHoverCoordinatorKey) : nil);
+}
+
++ (instancetype)coordinatorForWindow:(NSWindow *)window {
+	if (window == nil) return nil;
+	
+	BTRHoverCoordinator *coordinator = BTRHoverCoordinatorForWindow(window);
+	if (coordinator == nil) {
+		coordinator = [[self alloc] initWithWindow:window];
+		objc_setAssociatedObject(window, BTRHoverCoordinatorKey, coordinator, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+	return coordinator;
+}
+
+- (instancetype)initWithWindow:(NSWindow *)window {
+	self = [super init];
+	if (self == nil) return nil;
+	
+	_window = window;
+	_cells = [NSMutableDictionary dictionary];
+	_indexedRects = [NSMapTable weakToStrongObjectsMapTable];
+	_dirtyViews = [NSHashTable weakObjectsHashTable];
+	_dependentViews = [NSMapTable weakToStrongObjectsMapTable];
+	_dependencies = [NSMapTable weakToStrongObjectsMapTable];
+	_hoveredViews = [NSHashTable weakObjectsHashTable];
+	
+	NSNotificationCenter *nc = NSNotificationCenter.defaultCenter;
+	[nc addObserver:self selector:@selector(windowDidResize:) name:NSWindowDidResizeNotification object:window];
+	[nc addObserver:self selector:@selector(windowDidEndLiveResize:) name:NSWindowDidEndLiveResizeNotification object:window];
+	
+	return self;
+}
+
+- (void)dealloc {
+	[NSNotificationCenter.defaultCenter removeObserver:self];
+	// Tracking areas don't retain their owner.
+	[self.trackingView removeTrackingArea:self.trackingArea];
+	if (self.dragMonitor != nil) {
+		[NSEvent removeMonitor:self.dragMonitor];
+	}
+}
+
+#pragma mark Registration
+
+- (void)registerView:(NSView *)view {
+	if ([_indexedRects objectForKey:view] != nil) return;
+	
+	[self installTrackingAreaIfNeeded];
+	[self observeDependenciesOfView:view];
+	[self indexView:view];
+	[self setNeedsRefresh];
+}
+
+- (void)unregisterView:(NSView *)view {
+	[self stopObservingDependenciesOfView:view];
+	[self removeViewFromGrid:view];
+	[_indexedRects removeObjectForKey:view];
+	[_dirtyViews removeObject:view];
+	[_hoveredViews removeObject:view];
+}
+
+// Moving or scrolling a view moves every view inside it without changing
+// their frames, so the frames of a registered view and of its ancestors are
+// observed, along with the bounds of the clip views among them. Each
+// notification only dirties the registered views inside the view that posted
+// it, so scrolling re-indexes only the content of that clip view.
+- (void)observeDependenciesOfView:(NSView *)view {
+	NSNotificationCenter *nc = NSNotificationCenter.defaultCenter;
+	NSView *contentView = self.window.contentView;
+	NSHashTable *dependencies = [NSHashTable weakObjectsHashTable];
+	for (NSView *ancestor = view; ancestor != nil; ancestor = (ancestor == contentView ? nil : ancestor.superview)) {
+		[dependencies addObject:ancestor];
+		NSHashTable *dependents = [_dependentViews objectForKey:ancestor];
+		if (dependents == nil) {
+			dependents = [NSHashTable weakObjectsHashTable];
+			[_dependentViews setObject:dependents forKey:ancestor];
+			[nc addObserver:self selector:@selector(viewGeometryDidChange:) name:NSViewFrameDidChangeNotification object:ancestor];
+			if ([ancestor isKindOfClass:NSClipView.class]) {
+				ancestor.postsBoundsChangedNotifications = YES;
+				[nc addObserver:self selector:@selector(viewGeometryDidChange:) name:NSViewBoundsDidChangeNotification object:ancestor];
+			}
+		}
+		[dependents addObject:view];
+	}
+	[_dependencies setObject:dependencies forKey:view];
+}
+
+- (void)stopObservingDependenciesOfView:(NSView *)view {
+	NSNotificationCenter *nc = NSNotificationCenter.defaultCenter;
+	for (NSView *ancestor in [[_dependencies objectForKey:view] allObjects]) {
+		NSHashTable *dependents = [_dependentViews objectForKey:ancestor];
+		[dependents removeObject:view];
+		if (dependents.count == 0) {
+			[_dependentViews removeObjectForKey:ancestor];
+			[nc removeObserver:self name:NSViewFrameDidChangeNotification object:ancestor];
+			[nc removeObserver:self name:NSViewBoundsDidChangeNotification object:ancestor];
+		}
+	}
+	[_dependencies removeObjectForKey:view];
+}
+
+// The area is moved over if the window's content view has been replaced.
+- (void)installTrackingAreaIfNeeded {
+	NSView *contentView = self.window.contentView;
+	if (contentView == nil || (self.trackingView == contentView && [contentView.trackingAreas containsObject:self.trackingArea])) return;
+	
+	[self.trackingView removeTrackingArea:self.trackingArea];
+	
+	// NSTrackingInVisibleRect keeps the area in sync with the content view,
+	// so it never needs to be rebuilt.
+	if (self.trackingArea == nil) {
+		NSTrackingAreaOptions options = (NSTrackingMouseEnteredAndExited | NSTrackingMouseMoved | NSTrackingActiveAlways | NSTrackingInVisibleRect | NSTrackingEnabledDuringMouseDrag);
+		self.trackingArea = [[NSTrackingArea alloc] initWithRect:NSZeroRect options:options owner:self userInfo:nil];
+	}
+	[contentView addTrackingArea:self.trackingArea];
+	self.trackingView = contentView;
+	
+	// Mouse dragged events are only sent to the view that received the mouse
+	// down, so they are observed separately to update hover while dragging.
+	if (self.dragMonitor == nil) {
+		__weak BTRHoverCoordinator *weakSelf = self;
+		self.dragMonitor = [NSEvent addLocalMonitorForEventsMatchingMask:(NSLeftMouseDraggedMask | NSRightMouseDraggedMask) handler:^NSEvent *(NSEvent *event) {
+			BTRHoverCoordinator *strongSelf = weakSelf;
+			if (event.window == strongSelf.window && !event.window.inLiveResize) {
+				[strongSelf updateHoverWithLocation:event.locationInWindow event:event];
+			}
+			return event;
+		}];
+	}
+}
+
+#pragma mark Grid
+
+static NSValue *BTRHoverCellIndex(NSInteger x, NSInteger y) {
+	return [NSValue valueWithPoint:NSMakePoint(x, y)];
+}
+
+- (void)enumerateCellsInRect:(NSRect)rect usingBlock:(void (^)(NSValue *cellIndex))block {
+	if (NSIsEmptyRect(rect)) return;
+	NSInteger minX = (NSInteger)floor(NSMinX(rect) / BTRHoverCoordinatorCellSize);
+	NSInteger maxX = (NSInteger)floor(NSMaxX(rect) / BTRHoverCoordinatorCellSize);
+	NSInteger minY = (NSInteger)floor(NSMinY(rect) / BTRHoverCoordinatorCellSize);
+	NSInteger maxY = (NSInteger)floor(NSMaxY(rect) / BTRHoverCoordinatorCellSize);
+	for (NSInteger y = minY; y <= maxY; y++) {
+		for (NSInteger x = minX; x <= maxX; x++) {
+			block(BTRHoverCellIndex(x, y));
+		}
+	}
+}
+
+- (void)indexView:(NSView *)view {
+	[self removeViewFromGrid:view];
+	
+	NSRect rect = (view.window == self.window ? [view convertRect:view.visibleRect toView:nil] : NSZeroRect);
+	[_indexedRects setObject:[NSValue valueWithRect:rect] forKey:view];
+	[self enumerateCellsInRect:rect usingBlock:^(NSValue *cellIndex) {
+		NSHashTable *views = _cells[cellIndex];
+		if (views == nil) {
+			views = [NSHashTable weakObjectsHashTable];
+			_cells[cellIndex] = views;
+		}
+		[views addObject:view];
+	}];
+}
+
+- (void)removeViewFromGrid:(NSView *)view {
+	NSValue *indexedRect = [_indexedRects objectForKey:view];
+	if (indexedRect == nil) return;
+	[self enumerateCellsInRect:indexedRect.rectValue usingBlock:^(NSValue *cellIndex) {
+		NSHashTable *views = _cells[cellIndex];
+		[views removeObject:view];
+		if (views.count == 0) {
+			[_cells removeObjectForKey:cellIndex];
+		}
+	}];
+}
+
+- (void)reindexIfNeeded {
+	if (_needsFullReindex) {
+		BTRTraceScope(BTRTraceCategoryTrackingRebuild, "BTRHoverCoordinator.reindex");
+		_needsFullReindex = NO;
+		[_dirtyViews removeAllObjects];
+		[_cells removeAllObjects];
+		for (NSView *view in _indexedRects.keyEnumerator.allObjects) {
+			[_indexedRects setObject:[NSValue valueWithRect:NSZeroRect] forKey:view];
+			[self indexView:view];
+		}
+	} else if (_dirtyViews.count > 0) {
+		BTRTraceScope(BTRTraceCategoryTrackingRebuild, "BTRHoverCoordinator.reindexDirtyViews");
+		for (NSView *view in _dirtyViews.allObjects) {
+			[self indexView:view];
+		}
+		[_dirtyViews removeAllObjects];
+	}
+}
+
+#pragma mark Hover
+
+- (void)updateHoverWithLocation:(NSPoint)location event:(NSEvent *)event {
+	[self reindexIfNeeded];
+	
+	NSHashTable *insideViews = [NSHashTable weakObjectsHashTable];
+	NSInteger x = (NSInteger)floor(location.x / BTRHoverCoordinatorCellSize);
+	NSInteger y = (NSInteger)floor(location.y / BTRHoverCoordinatorCellSize);
+	for (NSView *view in [_cells[BTRHoverCellIndex(x, y)] allObjects]) {
+		if (view.isHiddenOrHasHiddenAncestor || view.window != self.window) continue;
+		NSPoint point = [view convertPoint:location fromView:nil];
+		if (NSPointInRect(point, view.visibleRect)) {
+			[insideViews addObject:view];
+		}
+	}
+	
+	NSArray *previousViews = _hoveredViews.allObjects;
+	_hoveredViews = insideViews;
+	
+	// Handlers can register or unregister views, so only act on snapshots.
+	for (NSView *view in previousViews) {
+		if (![insideViews containsObject:view]) {
+			[view mouseExited:event];
+		}
+	}
+	for (NSView *view in insideViews.allObjects) {
+		if (![previousViews containsObject:view]) {
+			[view mouseEntered:event];
+		}
+	}
+}
+
+// Frames change continuously during a live resize, so the index is only
+// brought up to date once the resize ends.
+- (void)setNeedsRefresh {
+	if (_refreshScheduled || self.window.inLiveResize) return;
+	_refreshScheduled = YES;
+	
+	__weak BTRHoverCoordinator *weakSelf = self;
+	dispatch_async(dispatch_get_main_queue(), ^{
+		[weakSelf refresh];
+	});
+}
+
+// Content can move underneath a stationary mouse, so hover is also updated
+// using the current mouse location after the index changes.
+- (void)refresh {
+	_refreshScheduled = NO;
+	NSWindow *window = self.window;
+	if (window == nil) return;
+	
+	if (_indexedRects.count > 0) {
+		[self installTrackingAreaIfNeeded];
+	}
+	[self updateHoverWithLocation:window.mouseLocationOutsideOfEventStream event:nil];
+}
+
+#pragma mark Events
+
+- (void)mouseMoved:(NSEvent *)event {
+	[self updateHoverWithLocation:event.locationInWindow event:event];
+}
+
+- (void)mouseEntered:(NSEvent *)event {
+	[self updateHoverWithLocation:event.locationInWindow event:event];
+}
+
+- (void)mouseExited:(NSEvent *)event {
+	for (NSView *view in _hoveredViews.allObjects) {
+		[view mouseExited:event];
+	}
+	[_hoveredViews removeAllObjects];
+}
+
+- (void)cursorUpdate:(NSEvent *)event {
+	// Not tracked.
+}
+
+#pragma mark Notifications
+
+- (void)viewGeometryDidChange:(NSNotification *)notification {
+	NSHashTable *dependents = [_dependentViews objectForKey:notification.object];
+	if (dependents.count == 0) return;
+	if (!_needsFullReindex) {
+		[_dirtyViews unionHashTable:dependents];
+	}
+	[self setNeedsRefresh];
+}
+
+- (void)windowDidResize:(NSNotification *)notification {
+	_needsFullReindex = YES;
+	[self setNeedsRefresh];
+}
+
+- (void)windowDidEndLiveResize:(NSNotification *)notification {
+	[self setNeedsRefresh];
+}
+
+@end
+
+@implementation NSView (BTRHoverCoordinator)
+
+- (void)btr_setTracksHover:(BOOL)tracksHover {
+	if (tracksHover) {
+		[[BTRHoverCoordinator coordinatorForWindow:self.window] registerView:self];
+	} else {
+		[BTRHoverCoordinatorForWindow(self.window) unregisterView:self];
+	}
+}
+
+- (void)btr_hoverViewWillMoveToWindow:(NSWindow *)newWindow {
+	if (newWindow != self.window) {
+		[BTRHoverCoordinatorForWindow(self.window) unregisterView:self];
+	}
+}
+
+@end
@@ -0,0 +1,24 @@
+//
+//  BTRRenderQueue.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+
+typedef void (^BTRRenderDrawingBlock)(CGContextRef ctx, CGRect bounds);
+
+// The shared queue on which all off-main-thread rendering is performed.
+//
+// The maximum number of renders in flight at once is bounded by the queue's
+// `maxConcurrentOperationCount`, which defaults to the active processor count.
+NSOperationQueue *BTRRenderQueue(void);
+
+// Renders `drawingBlock` into a new bitmap context of `size` points at the given
+// backing `scale`, returning the result as a new image or NULL if the size is empty.
+//
+// An NSGraphicsContext wrapping the bitmap context is made current for the
+// duration of the block, so that AppKit drawing can be used from any thread.
+CGImageRef BTRRenderQueueCreateImage(CGSize size, CGFloat scale, BOOL opaque, BOOL flipped, BTRRenderDrawingBlock drawingBlock) CF_RETURNS_RETAINED;
@@ -0,0 +1,51 @@
+//
+//  BTRRenderQueue.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRRenderQueue.h"
+#import "BTRTraceInternal.h"
+
+NSOperationQueue *BTRRenderQueue(void) {
+	static NSOperationQueue *queue = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		queue = [[NSOperationQueue alloc] init];
+		queue.name = @"com.butterkit.render";
+		queue.maxConcurrentOperationCount = NSProcessInfo.processInfo.activeProcessorCount;
+	});
+	return queue;
+}
+
+CGImageRef BTRRenderQueueCreateImage(CGSize size, CGFloat scale, BOOL opaque, BOOL flipped, BTRRenderDrawingBlock drawingBlock) {
+	size_t width = (size_t)ceil(size.width * scale);
+	size_t height = (size_t)ceil(size.height * scale);
+	if (width == 0 || height == 0 || drawingBlock == nil) return NULL;
+	
+	CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+	CGBitmapInfo bitmapInfo = kCGBitmapByteOrder32Host | (opaque ? kCGImageAlphaNoneSkipFirst : kCGImageAlphaPremultipliedFirst);
+	CGContextRef ctx = CGBitmapContextCreate(NULL, width, height, 8, 0, colorSpace, bitmapInfo);
+	CGColorSpaceRelease(colorSpace);
+	if (ctx == NULL) return NULL;
+	
+	CGContextScaleCTM(ctx, scale, scale);
+	if (flipped) {
+		CGContextTranslateCTM(ctx, 0, size.height);
+		CGContextScaleCTM(ctx, 1, -1);
+	}
+	
+	@autoreleasepool {
+		BTRTraceScope(BTRTraceCategoryDraw, "BTRRenderQueue.draw");
+		NSGraphicsContext *previousContext = NSGraphicsContext.currentContext;
+		NSGraphicsContext.currentContext = [NSGraphicsContext graphicsContextWithGraphicsPort:ctx flipped:flipped];
+		drawingBlock(ctx, (CGRect){ .size = size });
+		NSGraphicsContext.currentContext = previousContext;
+	}
+	
+	CGImageRef image = CGBitmapContextCreateImage(ctx);
+	CGContextRelease(ctx);
+	return image;
+}
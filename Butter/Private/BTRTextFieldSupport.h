@@ -0,0 +1,39 @@
+//
+//  BTRTextFieldSupport.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+
+// The parts of a text field its cell draws into the field's layer.
+typedef NS_OPTIONS(NSUInteger, BTRTextFieldDrawingParts) {
+	BTRTextFieldDrawingPartBackground = 1 << 0,
+	BTRTextFieldDrawingPartText = 1 << 1,
+	BTRTextFieldDrawingPartAll = BTRTextFieldDrawingPartBackground | BTRTextFieldDrawingPartText
+};
+
+// Behavior shared by BTRTextField and BTRSecureTextField, which inherit from
+// different AppKit classes.
+@interface NSTextField (BTRTextFieldSupport)
+
+// The focus ring follows the rounded border, so the layer is given an explicit
+// shadow path instead of having the shadow derived from its alpha offscreen.
+- (void)btr_updateFocusRingShadowPathWithCornerRadius:(CGFloat)cornerRadius;
+
+// Redrawing the field for every intermediate size is what makes a live resize
+// slow, so the contents drawn before it started are kept until it ends.
+//
+// Text would be distorted by stretching, so it is pinned according to its
+// alignment. A background is split from the text: the text is captured once
+// into a pinned sublayer, and the field's own layer draws only the background,
+// which is stretched using the rounded border as cap insets.
+- (void)btr_beginLiveResizeWithCornerRadius:(CGFloat)cornerRadius drawsBackground:(BOOL)drawsBackground;
+- (void)btr_endLiveResize;
+
+// The parts the cell should draw. Everything outside of a live resize.
+@property (nonatomic, readonly) BTRTextFieldDrawingParts btr_drawingParts;
+
+@end
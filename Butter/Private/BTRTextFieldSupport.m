@@ -0,0 +1,117 @@
+//
+//  BTRTextFieldSupport.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRTextFieldSupport.h"
+#import "BTRGeometryAdditions.h"
+#import <objc/runtime.h>
+
+// The state of a text field during a live resize.
+@interface BTRTextFieldLiveResize : NSObject
+@property (nonatomic, assign) NSViewLayerContentsPlacement placement;
+@property (nonatomic, assign) BTRTextFieldDrawingParts drawingParts;
+@property (nonatomic, strong) CALayer *textLayer;
+@end
+
+@implementation BTRTextFieldLiveResize
+@end
+
+static const void *BTRTextFieldLiveResizeKey = &BTRTextFieldLiveResizeKey;
+
+static NSViewLayerContentsPlacement BTRTextFieldContentsPlacementForAlignment(NSTextAlignment alignment) {
+	switch (alignment) {
+		case NSRightTextAlignment:
+			return NSViewLayerContentsPlacementTopRight;
+		case NSCenterTextAlignment:
+			return NSViewLayerContentsPlacementTop;
+		default:
+			return NSViewLayerContentsPlacementTopLeft;
+	}
+}
+
+// Keeps the text layer vertically centered, as the cell centers the text, and
+// on the side of the field the text is aligned to.
+static CAAutoresizingMask BTRTextFieldAutoresizingMaskForAlignment(NSTextAlignment alignment) {
+	CAAutoresizingMask mask = kCALayerMinYMargin | kCALayerMaxYMargin;
+	switch (alignment) {
+		case NSRightTextAlignment:
+			return mask | kCALayerMinXMargin;
+		case NSCenterTextAlignment:
+			return mask | kCALayerMinXMargin | kCALayerMaxXMargin;
+		default:
+			return mask | kCALayerMaxXMargin;
+	}
+}
+
+@implementation NSTextField (BTRTextFieldSupport)
+
+- (void)btr_updateFocusRingShadowPathWithCornerRadius:(CGFloat)cornerRadius {
+	CGPathRef path = BTRCGPathCreateWithRoundedRect(self.bounds, cornerRadius);
+	self.layer.shadowPath = path;
+	CGPathRelease(path);
+}
+
+#pragma mark Live resize
+
+- (BTRTextFieldLiveResize *)btr_liveResize {
+	return objc_getAssociatedObject(self, BTRTextFieldLiveResizeKey);
+}
+
+- (BTRTextFieldDrawingParts)btr_drawingParts {
+	BTRTextFieldLiveResize *liveResize = self.btr_liveResize;
+	return (liveResize != nil ? liveResize.drawingParts : BTRTextFieldDrawingPartAll);
+}
+
+- (void)btr_beginLiveResizeWithCornerRadius:(CGFloat)cornerRadius drawsBackground:(BOOL)drawsBackground {
+	BTRTextFieldLiveResize *liveResize = [BTRTextFieldLiveResize new];
+	liveResize.placement = self.layerContentsPlacement;
+	liveResize.drawingParts = BTRTextFieldDrawingPartAll;
+	objc_setAssociatedObject(self, BTRTextFieldLiveResizeKey, liveResize, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	
+	// While editing, the field editor draws the text in a subview of its own.
+	NSRect bounds = self.bounds;
+	BOOL stretchesBackground = (drawsBackground && self.currentEditor == nil && MIN(NSWidth(bounds), NSHeight(bounds)) > 2 * cornerRadius);
+	if (!stretchesBackground) {
+		self.layerContentsPlacement = BTRTextFieldContentsPlacementForAlignment(self.alignment);
+		return;
+	}
+	
+	liveResize.drawingParts = BTRTextFieldDrawingPartText;
+	NSBitmapImageRep *textBitmap = [self bitmapImageRepForCachingDisplayInRect:bounds];
+	[self cacheDisplayInRect:bounds toBitmapImageRep:textBitmap];
+	NSImage *textImage = [[NSImage alloc] initWithSize:bounds.size];
+	[textImage addRepresentation:textBitmap];
+	
+	CALayer *textLayer = [CALayer layer];
+	textLayer.frame = self.layer.bounds;
+	textLayer.contents = textImage;
+	textLayer.contentsScale = self.layer.contentsScale;
+	textLayer.autoresizingMask = BTRTextFieldAutoresizingMaskForAlignment(self.alignment);
+	// The layer has to follow every resize step, and appear and disappear
+	// together with the drawn text it replaces.
+	textLayer.actions = @{ @"position": NSNull.null, @"bounds": NSNull.null, @"onOrderIn": NSNull.null, @"onOrderOut": NSNull.null };
+	[self.layer addSublayer:textLayer];
+	liveResize.textLayer = textLayer;
+	
+	// Redrawn once, without the text, at the size the resize started at.
+	liveResize.drawingParts = BTRTextFieldDrawingPartBackground;
+	self.layer.contentsCenter = BTRCAContentsCenterForInsets(NSEdgeInsetsMake(cornerRadius, cornerRadius, cornerRadius, cornerRadius), bounds.size);
+	[self setNeedsDisplay:YES];
+}
+
+- (void)btr_endLiveResize {
+	BTRTextFieldLiveResize *liveResize = self.btr_liveResize;
+	if (liveResize == nil) return;
+	
+	[liveResize.textLayer removeFromSuperlayer];
+	self.layerContentsPlacement = liveResize.placement;
+	self.layer.contentsCenter = CGRectMake(0.0, 0.0, 1.0, 1.0);
+	objc_setAssociatedObject(self, BTRTextFieldLiveResizeKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	[self setNeedsDisplay:YES];
+}
+
+@end
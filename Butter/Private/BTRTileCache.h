@@ -0,0 +1,50 @@
+//
+//  BTRTileCache.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Identifies a single rendered tile. Two keys are equal only if they refer
+// to the same tile index, rendered at the same scale, from the same
+// generation of the tile's content.
+@interface BTRTileKey : NSObject <NSCopying>
+
++ (instancetype)keyWithColumn:(NSInteger)column row:(NSInteger)row scale:(CGFloat)scale generation:(NSUInteger)generation;
+
+@property (nonatomic, readonly) NSInteger column;
+@property (nonatomic, readonly) NSInteger row;
+@property (nonatomic, readonly) CGFloat scale;
+@property (nonatomic, readonly) NSUInteger generation;
+
+@end
+
+// A bounded least-recently-used cache. Not thread safe; only use it from
+// the main thread.
+@interface BTRTileCache : NSObject
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+// The maximum number of objects held by the cache. Lowering the capacity
+// immediately evicts the least recently used objects.
+@property (nonatomic, assign) NSUInteger capacity;
+
+@property (nonatomic, readonly) NSUInteger count;
+
+// Returns the object for the key, marking it as the most recently used.
+- (id)objectForKey:(id<NSCopying>)key;
+
+// Adds the object as the most recently used, evicting the least recently
+// used object if the cache is full.
+- (void)setObject:(id)object forKey:(id<NSCopying>)key;
+
+- (void)removeObjectForKey:(id<NSCopying>)key;
+
+// Removes every object whose key passes the test.
+- (void)removeObjectsForKeysPassingTest:(BOOL (^)(id key))predicate;
+- (void)removeAllObjects;
+
+@end
@@ -0,0 +1,120 @@
+//
+//  BTRTileCache.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRTileCache.h"
+
+@implementation BTRTileKey
+
++ (instancetype)keyWithColumn:(NSInteger)column row:(NSInteger)row scale:(CGFloat)scale generation:(NSUInteger)generation {
+	BTRTileKey *key = [self new];
+	key->_column = column;
+	key->_row = row;
+	key->_scale = scale;
+	key->_generation = generation;
+	return key;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+	return self;
+}
+
+- (BOOL)isEqual:(id)object {
+	if (object == self) return YES;
+	if (![object isKindOfClass:BTRTileKey.class]) return NO;
+	BTRTileKey *key = object;
+	return key.column == self.column && key.row == self.row && key.scale == self.scale && key.generation == self.generation;
+}
+
+- (NSUInteger)hash {
+	return (NSUInteger)self.column * 31 ^ (NSUInteger)self.row * 17 ^ (NSUInteger)(self.scale * 4) ^ self.generation << 8;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ %ld, %ld @%gx, generation = %lu }", self.class, self, (long)self.column, (long)self.row, self.scale, (unsigned long)self.generation];
+}
+
+@end
+
+@implementation BTRTileCache {
+	NSMutableDictionary *_objects;
+	// Ordered from least to most recently used.
+	NSMutableOrderedSet *_keys;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+	self = [super init];
+	if (self == nil) return nil;
+	
+	_capacity = capacity;
+	_objects = [NSMutableDictionary dictionaryWithCapacity:capacity];
+	_keys = [NSMutableOrderedSet orderedSetWithCapacity:capacity];
+	
+	return self;
+}
+
+- (instancetype)init {
+	return [self initWithCapacity:64];
+}
+
+- (NSUInteger)count {
+	return _objects.count;
+}
+
+- (void)setCapacity:(NSUInteger)capacity {
+	_capacity = capacity;
+	[self evictIfNeeded];
+}
+
+- (id)objectForKey:(id<NSCopying>)key {
+	id object = _objects[key];
+	if (object != nil) {
+		[_keys removeObject:key];
+		[_keys addObject:key];
+	}
+	return object;
+}
+
+- (void)setObject:(id)object forKey:(id<NSCopying>)key {
+	if (object == nil) {
+		[self removeObjectForKey:key];
+		return;
+	}
+	
+	_objects[key] = object;
+	[_keys removeObject:key];
+	[_keys addObject:key];
+	[self evictIfNeeded];
+}
+
+- (void)removeObjectForKey:(id<NSCopying>)key {
+	[_objects removeObjectForKey:key];
+	[_keys removeObject:key];
+}
+
+- (void)removeObjectsForKeysPassingTest:(BOOL (^)(id key))predicate {
+	NSIndexSet *indexes = [_keys indexesOfObjectsPassingTest:^BOOL(id key, NSUInteger idx, BOOL *stop) {
+		return predicate(key);
+	}];
+	[_objects removeObjectsForKeys:[_keys objectsAtIndexes:indexes]];
+	[_keys removeObjectsAtIndexes:indexes];
+}
+
+- (void)removeAllObjects {
+	[_objects removeAllObjects];
+	[_keys removeAllObjects];
+}
+
+- (void)evictIfNeeded {
+	while (_keys.count > self.capacity) {
+		id key = _keys.firstObject;
+		[_objects removeObjectForKey:key];
+		[_keys removeObjectAtIndex:0];
+	}
+}
+
+@end
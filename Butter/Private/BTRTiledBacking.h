@@ -0,0 +1,47 @@
+//
+//  BTRTiledBacking.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import <Cocoa/Cocoa.h>
+#import "BTRRenderQueue.h"
+
+@class BTRView;
+
+// Manages the tiles of a BTRView using tiled backing.
+//
+// Tiles are laid out on a fixed grid in the view's coordinate space, rendered
+// on demand on the shared render queue, and kept in a bounded LRU cache keyed
+// by tile index, scale and content generation. Only the tiles intersecting the
+// visible and prefetch rects are attached to the view's layer.
+@interface BTRTiledBacking : NSObject
+
+- (instancetype)initWithView:(BTRView *)view;
+
+// The sublayer of the view's layer that hosts the tile layers.
+@property (nonatomic, strong, readonly) CALayer *containerLayer;
+
+@property (nonatomic, assign) CGSize tileSize;
+@property (nonatomic, assign) NSUInteger maximumCachedTileCount;
+
+// Invalidates the content of every tile intersecting the rect.
+- (void)setNeedsDisplayInRect:(CGRect)rect;
+
+// Invalidates the content of every tile.
+- (void)setNeedsDisplay;
+
+// Invalidates the edge tiles affected by a change in the view's size.
+- (void)boundsSizeDidChangeFromSize:(CGSize)oldSize;
+
+// Attaches the tiles intersecting `visibleRect` and `prefetchRect`, detaching
+// all others, and renders the tiles which don't have up to date contents.
+// Visible tiles are rendered before prefetched tiles.
+- (void)updateTilesWithVisibleRect:(CGRect)visibleRect prefetchRect:(CGRect)prefetchRect;
+
+// Cancels all pending renders and removes the tiles from the view's layer.
+- (void)tearDown;
+
+@end
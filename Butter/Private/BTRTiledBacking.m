@@ -0,0 +1,282 @@
+//
+//  BTRTiledBacking.m
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRTiledBacking.h"
+#import "BTRTileCache.h"
+#import "BTRView.h"
+#import <QuartzCore/QuartzCore.h>
+
+// Used as the dictionary key for per-tile state that doesn't depend on scale or generation.
+static NSValue *BTRTileIndex(NSInteger column, NSInteger row) {
+	return [NSValue valueWithPoint:NSMakePoint(column, row)];
+}
+
+@implementation BTRTiledBacking {
+	__weak BTRView *_view;
+	BTRTileCache *_cache;
+	NSUInteger _maximumCachedTileCount;
+	
+	// Every invalidation takes the next value of this counter, so that
+	// generations are unique across both whole-view and per-tile invalidation.
+	NSUInteger _generationCounter;
+	NSUInteger _baseGeneration;
+	NSMutableDictionary *_tileGenerations;
+	
+	// The scale the tiles in the cache were last rendered at.
+	CGFloat _scale;
+	
+	NSMutableDictionary *_tileLayers;
+	NSMutableDictionary *_pendingOperations;
+}
+
+- (instancetype)initWithView:(BTRView *)view {
+	self = [super init];
+	if (self == nil) return nil;
+	
+	_view = view;
+	_tileSize = CGSizeMake(256, 256);
+	_maximumCachedTileCount = 64;
+	_cache = [[BTRTileCache alloc] initWithCapacity:_maximumCachedTileCount];
+	_tileGenerations = [NSMutableDictionary dictionary];
+	_tileLayers = [NSMutableDictionary dictionary];
+	_pendingOperations = [NSMutableDictionary dictionary];
+	
+	_containerLayer = [CALayer layer];
+	_containerLayer.anchorPoint = CGPointZero;
+	_containerLayer.zPosition = -1;
+	_containerLayer.actions = @{ @"bounds": NSNull.null, @"position": NSNull.null, @"sublayers": NSNull.null };
+	
+	return self;
+}
+
+#pragma mark Properties
+
+- (NSUInteger)maximumCachedTileCount {
+	return _maximumCachedTileCount;
+}
+
+- (void)setMaximumCachedTileCount:(NSUInteger)count {
+	_maximumCachedTileCount = count;
+	_cache.capacity = MAX(count, _tileLayers.count);
+}
+
+- (void)setTileSize:(CGSize)tileSize {
+	if (!CGSizeEqualToSize(_tileSize, tileSize) && tileSize.width > 0 && tileSize.height > 0) {
+		_tileSize = tileSize;
+		[self tearDown];
+		[self setNeedsDisplay];
+	}
+}
+
+#pragma mark Tile geometry
+
+- (CGRect)rectForTileAtColumn:(NSInteger)column row:(NSInteger)row {
+	CGRect tileRect = CGRectMake(column * self.tileSize.width, row * self.tileSize.height, self.tileSize.width, self.tileSize.height);
+	return CGRectIntersection(tileRect, _view.bounds);
+}
+
+- (void)enumerateTilesInRect:(CGRect)rect usingBlock:(void (^)(NSInteger column, NSInteger row))block {
+	rect = CGRectIntersection(rect, _view.bounds);
+	if (CGRectIsEmpty(rect)) return;
+	
+	NSInteger minColumn = (NSInteger)floor(CGRectGetMinX(rect) / self.tileSize.width);
+	NSInteger maxColumn = (NSInteger)ceil(CGRectGetMaxX(rect) / self.tileSize.width);
+	NSInteger minRow = (NSInteger)floor(CGRectGetMinY(rect) / self.tileSize.height);
+	NSInteger maxRow = (NSInteger)ceil(CGRectGetMaxY(rect) / self.tileSize.height);
+	for (NSInteger row = minRow; row < maxRow; row++) {
+		for (NSInteger column = minColumn; column < maxColumn; column++) {
+			block(column, row);
+		}
+	}
+}
+
+- (NSUInteger)generationForTileAtColumn:(NSInteger)column row:(NSInteger)row {
+	NSNumber *generation = _tileGenerations[BTRTileIndex(column, row)];
+	return MAX(_baseGeneration, generation.unsignedIntegerValue);
+}
+
+#pragma mark Invalidation
+
+- (void)setNeedsDisplayInRect:(CGRect)rect {
+	NSMutableSet *indexes = [NSMutableSet set];
+	[self enumerateTilesInRect:rect usingBlock:^(NSInteger column, NSInteger row) {
+		NSValue *index = BTRTileIndex(column, row);
+		_tileGenerations[index] = @(++_generationCounter);
+		[indexes addObject:index];
+	}];
+	if (indexes.count == 0) return;
+	
+	// The previous generations of these tiles can never be displayed again.
+	[_cache removeObjectsForKeysPassingTest:^BOOL(BTRTileKey *key) {
+		return [indexes containsObject:BTRTileIndex(key.column, key.row)];
+	}];
+}
+
+- (void)setNeedsDisplay {
+	_baseGeneration = ++_generationCounter;
+	[_tileGenerations removeAllObjects];
+	[_cache removeAllObjects];
+}
+
+- (void)boundsSizeDidChangeFromSize:(CGSize)oldSize {
+	CGSize newSize = _view.bounds.size;
+	CGFloat width = MAX(oldSize.width, newSize.width);
+	CGFloat height = MAX(oldSize.height, newSize.height);
+	
+	// Only the last column and row of tiles in the old and new sizes can change shape.
+	if (oldSize.width != newSize.width) {
+		CGFloat minX = floor(MIN(oldSize.width, newSize.width) / self.tileSize.width) * self.tileSize.width;
+		[self setNeedsDisplayInRect:CGRectMake(minX, 0, width - minX, height)];
+	}
+	if (oldSize.height != newSize.height) {
+		CGFloat minY = floor(MIN(oldSize.height, newSize.height) / self.tileSize.height) * self.tileSize.height;
+		[self setNeedsDisplayInRect:CGRectMake(0, minY, width, height - minY)];
+	}
+}
+
+#pragma mark Updating
+
+- (void)updateTilesWithVisibleRect:(CGRect)visibleRect prefetchRect:(CGRect)prefetchRect {
+	BTRView *view = _view;
+	if (view == nil) return;
+	
+	self.containerLayer.frame = view.layer.bounds;
+	if (self.containerLayer.superlayer != view.layer) {
+		[view.layer insertSublayer:self.containerLayer atIndex:0];
+	}
+	
+	CGFloat scale = view.window.backingScaleFactor ?: 1;
+	if (scale != _scale) {
+		_scale = scale;
+		[_cache removeObjectsForKeysPassingTest:^BOOL(BTRTileKey *key) {
+			return key.scale != scale;
+		}];
+	}
+	NSMutableSet *neededIndexes = [NSMutableSet set];
+	NSMutableArray *tiles = [NSMutableArray array];
+	
+	void (^collectTile)(NSInteger, NSInteger) = ^(NSInteger column, NSInteger row) {
+		NSValue *index = BTRTileIndex(column, row);
+		if ([neededIndexes containsObject:index]) return;
+		[neededIndexes addObject:index];
+		[tiles addObject:index];
+	};
+	[self enumerateTilesInRect:visibleRect usingBlock:collectTile];
+	NSUInteger visibleTileCount = tiles.count;
+	[self enumerateTilesInRect:prefetchRect usingBlock:collectTile];
+	
+	// The cache always holds at least the attached tiles, so that a small
+	// maximum never evicts tiles on screen and renders them again on every update.
+	_cache.capacity = MAX(_maximumCachedTileCount, tiles.count);
+	
+	// Detach the tiles that are no longer needed, and cancel their renders.
+	for (NSValue *index in _tileLayers.allKeys) {
+		if (![neededIndexes containsObject:index]) {
+			[_tileLayers[index] removeFromSuperlayer];
+			[_tileLayers removeObjectForKey:index];
+		}
+	}
+	for (BTRTileKey *key in _pendingOperations.allKeys) {
+		NSValue *index = BTRTileIndex(key.column, key.row);
+		if (![neededIndexes containsObject:index] || key.scale != scale || key.generation != [self generationForTileAtColumn:key.column row:key.row]) {
+			[_pendingOperations[key] cancel];
+			[_pendingOperations removeObjectForKey:key];
+		}
+	}
+	
+	[CATransaction begin];
+	[CATransaction setDisableActions:YES];
+	[tiles enumerateObjectsUsingBlock:^(NSValue *index, NSUInteger idx, BOOL *stop) {
+		NSInteger column = (NSInteger)index.pointValue.x;
+		NSInteger row = (NSInteger)index.pointValue.y;
+		CGRect tileRect = [self rectForTileAtColumn:column row:row];
+		
+		CALayer *tileLayer = _tileLayers[index];
+		if (tileLayer == nil) {
+			tileLayer = [CALayer layer];
+			tileLayer.opaque = view.opaque;
+			[self.containerLayer addSublayer:tileLayer];
+			_tileLayers[index] = tileLayer;
+		}
+		tileLayer.frame = tileRect;
+		
+		BTRTileKey *key = [BTRTileKey keyWithColumn:column row:row scale:scale generation:[self generationForTileAtColumn:column row:row]];
+		id contents = [_cache objectForKey:key];
+		if (contents != nil) {
+			tileLayer.contentsScale = scale;
+			tileLayer.contents = contents;
+		} else {
+			// Stale contents are left in place until the new render arrives.
+			NSOperationQueuePriority priority = (idx < visibleTileCount ? NSOperationQueuePriorityVeryHigh : NSOperationQueuePriorityLow);
+			[self renderTileWithKey:key rect:tileRect priority:priority];
+		}
+	}];
+	[CATransaction commit];
+}
+
+- (void)renderTileWithKey:(BTRTileKey *)key rect:(CGRect)tileRect priority:(NSOperationQueuePriority)priority {
+	NSOperation *pendingOperation = _pendingOperations[key];
+	if (pendingOperation != nil) {
+		pendingOperation.queuePriority = priority;
+		return;
+	}
+	
+	BTRView *view = _view;
+	void (^drawingBlock)(CGContextRef, CGRect) = view.asynchronousDrawingBlock;
+	if (drawingBlock == nil || CGRectIsEmpty(tileRect)) return;
+	
+	BOOL opaque = view.opaque;
+	BOOL flipped = view.flipped;
+	
+	__weak BTRTiledBacking *weakSelf = self;
+	NSBlockOperation *operation = [[NSBlockOperation alloc] init];
+	__weak NSBlockOperation *weakOperation = operation;
+	[operation addExecutionBlock:^{
+		if (weakOperation.isCancelled) return;
+		CGImageRef image = BTRRenderQueueCreateImage(tileRect.size, key.scale, opaque, flipped, ^(CGContextRef ctx, CGRect bounds) {
+			CGContextTranslateCTM(ctx, -tileRect.origin.x, -tileRect.origin.y);
+			drawingBlock(ctx, tileRect);
+		});
+		dispatch_async(dispatch_get_main_queue(), ^{
+			[weakSelf finishRenderingTileWithKey:key image:(__bridge id)image];
+			CGImageRelease(image);
+		});
+	}];
+	operation.queuePriority = priority;
+	
+	_pendingOperations[key] = operation;
+	[BTRRenderQueue() addOperation:operation];
+}
+
+- (void)finishRenderingTileWithKey:(BTRTileKey *)key image:(id)image {
+	[_pendingOperations removeObjectForKey:key];
+	if (image == nil || key.generation != [self generationForTileAtColumn:key.column row:key.row]) return;
+	
+	[_cache setObject:image forKey:key];
+	
+	CALayer *tileLayer = _tileLayers[BTRTileIndex(key.column, key.row)];
+	if (tileLayer == nil) return;
+	
+	[CATransaction begin];
+	[CATransaction setDisableActions:YES];
+	tileLayer.contentsScale = key.scale;
+	tileLayer.contents = image;
+	[CATransaction commit];
+}
+
+- (void)tearDown {
+	for (NSOperation *operation in _pendingOperations.allValues) {
+		[operation cancel];
+	}
+	[_pendingOperations removeAllObjects];
+	[_tileLayers removeAllObjects];
+	self.containerLayer.sublayers = nil;
+	[self.containerLayer removeFromSuperlayer];
+}
+
+@end
@@ -0,0 +1,39 @@
+//
+//  BTRTraceInternal.h
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#import "BTRTrace.h"
+
+typedef struct {
+	BTRTraceCategory category;
+	const char *name;
+	uint64_t start;
+} BTRTraceSpan;
+
+#if BTR_TRACE_ENABLED
+
+void BTRTraceIncrementCounter(BTRTraceCategory category);
+BTRTraceSpan BTRTraceSpanBegin(BTRTraceCategory category, const char *name);
+void BTRTraceSpanEnd(BTRTraceSpan *span);
+
+#define BTR_TRACE_CONCAT_(a, b) a ## b
+#define BTR_TRACE_CONCAT(a, b) BTR_TRACE_CONCAT_(a, b)
+
+// Increments the counter for the category.
+#define BTRTraceCount(category) BTRTraceIncrementCounter(category)
+
+// Increments the counter for the category and, while recording, records a span
+// lasting until the end of the enclosing scope. `name` must be a string literal.
+#define BTRTraceScope(category, name) \
+	__attribute__((cleanup(BTRTraceSpanEnd), unused)) BTRTraceSpan BTR_TRACE_CONCAT(_btrTraceSpan, __LINE__) = BTRTraceSpanBegin(category, name)
+
+#else
+
+#define BTRTraceCount(category) do {} while (0)
+#define BTRTraceScope(category, name) do {} while (0)
+
+#endif
@@ -0,0 +1,191 @@
+//
+//  BTRCoreControlTests.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include "BTRCoreControl.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace btr::test;
+
+namespace {
+
+// Control state resolution
+
+BTR_TEST("control/state_disabled_overrides_flags", [] {
+	BTR_EXPECT_EQUAL(BTRCoreControlStateResolve(false, true, true, true), (BTRCoreControlState)BTRCoreControlStateDisabled);
+});
+
+BTR_TEST("control/state_highlight_follows_mouse", [] {
+	BTR_EXPECT_EQUAL(BTRCoreControlStateResolve(true, false, false, false), (BTRCoreControlState)BTRCoreControlStateNormal);
+	BTR_EXPECT_EQUAL(BTRCoreControlStateResolve(true, true, true, false), (BTRCoreControlState)BTRCoreControlStateHighlighted);
+	BTR_EXPECT_EQUAL(BTRCoreControlStateResolve(true, true, false, false), (BTRCoreControlState)BTRCoreControlStateHover);
+	BTR_EXPECT_EQUAL(BTRCoreControlStateResolve(true, true, true, true), (BTRCoreControlState)(BTRCoreControlStateHighlighted | BTRCoreControlStateSelected));
+});
+
+// Continuous event coalescing
+
+const uint32_t dragEnter = BTRCoreControlEventMouseDragEnter;
+const uint32_t dragExit = BTRCoreControlEventMouseDragExit;
+const uint32_t other = 1 << 0;
+
+BTR_TEST("control/coalesce_opposites_cancel", [] {
+	uint32_t pending = BTRCoreContinuousEventsCoalesce(0, dragEnter);
+	BTR_EXPECT_EQUAL(pending, dragEnter);
+	pending = BTRCoreContinuousEventsCoalesce(pending, dragExit);
+	BTR_EXPECT_EQUAL(pending, 0u);
+	pending = BTRCoreContinuousEventsCoalesce(pending, dragExit);
+	BTR_EXPECT_EQUAL(pending, dragExit);
+});
+
+BTR_TEST("control/coalesce_net_transition", [] {
+	// Crossing the bounds back and forth leaves only the last odd transition.
+	uint32_t pending = 0;
+	for (int i = 0; i < 7; i++) {
+		pending = BTRCoreContinuousEventsCoalesce(pending, (i % 2) ? dragExit : dragEnter);
+	}
+	BTR_EXPECT_EQUAL(pending, dragEnter);
+});
+
+BTR_TEST("control/coalesce_keeps_other_events", [] {
+	uint32_t pending = BTRCoreContinuousEventsCoalesce(0, other | dragEnter);
+	pending = BTRCoreContinuousEventsCoalesce(pending, dragExit);
+	BTR_EXPECT_EQUAL(pending, other);
+});
+
+// Action lists
+
+void RecordIndex(size_t index, uint32_t, void *context) {
+	static_cast<std::vector<size_t> *>(context)->push_back(index);
+}
+
+BTR_TEST("control/action_list_dispatch_matches_masks", [] {
+	BTRCoreActionList list;
+	BTRCoreActionListInit(&list);
+	for (uint32_t i = 0; i < 10; i++) {
+		BTR_EXPECT(BTRCoreActionListAppend(&list, 1u << (i % 3)));
+	}
+	BTR_EXPECT_EQUAL(list.combinedEvents, 7u);
+	
+	std::vector<size_t> called;
+	BTR_EXPECT_EQUAL(BTRCoreActionListDispatch(&list, 1u << 1, RecordIndex, &called), 3u);
+	BTR_EXPECT(called == std::vector<size_t>({ 1, 4, 7 }));
+	
+	called.clear();
+	BTR_EXPECT_EQUAL(BTRCoreActionListDispatch(&list, 1u << 5, RecordIndex, &called), 0u);
+	BTR_EXPECT(called.empty());
+	BTRCoreActionListDestroy(&list);
+});
+
+BTR_TEST("control/action_list_remove_all_reuses_storage", [] {
+	BTRCoreActionList list;
+	BTRCoreActionListInit(&list);
+	for (int i = 0; i < 5; i++) BTRCoreActionListAppend(&list, 1);
+	size_t capacity = list.capacity;
+	BTRCoreActionListRemoveAll(&list);
+	BTR_EXPECT_EQUAL(list.count, 0u);
+	BTR_EXPECT_EQUAL(list.combinedEvents, 0u);
+	BTR_EXPECT_EQUAL(list.capacity, capacity);
+	
+	std::vector<size_t> called;
+	BTR_EXPECT_EQUAL(BTRCoreActionListDispatch(&list, 1, RecordIndex, &called), 0u);
+	BTRCoreActionListDestroy(&list);
+});
+
+// Pop up button layout
+//
+// The reference is BTRPopUpButton's original -labelFrame, transcribed with
+// CGFloat as double, which the core must reproduce exactly, including when a
+// subclass has replaced the image or arrow frame.
+
+BTRCoreRect ReferenceLabelFrame(BTRCoreRect bounds, BTRCoreRect imageFrame, BTRCoreRect arrowFrame, double titleWidth, BTRCoreTextAlignment alignment, double edgeInset, double spacing) {
+	double maximumWidth = bounds.width - (imageFrame.x + imageFrame.width) - arrowFrame.width - edgeInset;
+	if (imageFrame.width) {
+		maximumWidth -= spacing;
+	}
+	if (arrowFrame.width) {
+		maximumWidth -= spacing;
+	}
+	const double textWidth = fminf(titleWidth, maximumWidth);
+	double xOrigin;
+	switch (alignment) {
+		case BTRCoreTextAlignmentRight:
+			xOrigin = arrowFrame.x - spacing - textWidth;
+			break;
+		case BTRCoreTextAlignmentCenter:
+			xOrigin = floorf((bounds.x + bounds.width * 0.5) - (textWidth / 2.f));
+			break;
+		case BTRCoreTextAlignmentLeft:
+		default:
+			xOrigin = (imageFrame.x + imageFrame.width) + spacing;
+			break;
+	}
+	return BTRCoreRect{ xOrigin, 0.f, textWidth, bounds.height };
+}
+
+bool RectsEqual(BTRCoreRect a, BTRCoreRect b) {
+	return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+BTR_TEST("control/popup_image_and_arrow_frames", [] {
+	const BTRCoreRect bounds = { 0, 0, 120, 25 };
+	BTRCoreRect image = BTRCorePopUpButtonImageFrame(bounds, 16, 15, 6);
+	BTR_EXPECT(RectsEqual(image, BTRCoreRect{ 6, roundf(12.5f - 7.5f), 16, 15 }));
+	BTRCoreRect arrow = BTRCorePopUpButtonArrowFrame(bounds, 7, 10, 6);
+	BTR_EXPECT(RectsEqual(arrow, BTRCoreRect{ 120 - 7 - 6, roundf(12.5f - 5.f), 7, 10 }));
+});
+
+BTR_TEST("control/popup_label_frame_matches_reference", [] {
+	const BTRCoreTextAlignment alignments[] = { BTRCoreTextAlignmentLeft, BTRCoreTextAlignmentRight, BTRCoreTextAlignmentCenter };
+	const double widths[] = { 0, 33, 80.5, 121, 300 };
+	const double heights[] = { 17, 22.5, 25 };
+	const double imageSizes[] = { 0, 16, 17.5 };
+	const double arrowSizes[] = { 0, 7, 9.5 };
+	const double titleWidths[] = { 0, 12, 45.25, 64, 500 };
+	
+	size_t mismatches = 0;
+	for (double width : widths) for (double height : heights) {
+		const BTRCoreRect bounds = { 0, 0, width, height };
+		for (double imageSize : imageSizes) for (double arrowSize : arrowSizes) {
+			const BTRCoreRect defaultImage = BTRCorePopUpButtonImageFrame(bounds, imageSize, imageSize, 6);
+			const BTRCoreRect defaultArrow = BTRCorePopUpButtonArrowFrame(bounds, arrowSize, arrowSize, 6);
+			// A subclass hook moving the image inward and the arrow to the left.
+			const BTRCoreRect hookedImage = { 10.5, 2, imageSize + 4, imageSize };
+			const BTRCoreRect hookedArrow = { width / 3, 1, arrowSize + 2, arrowSize };
+			const BTRCoreRect images[] = { defaultImage, hookedImage };
+			const BTRCoreRect arrows[] = { defaultArrow, hookedArrow };
+			
+			for (const BTRCoreRect &image : images) for (const BTRCoreRect &arrow : arrows) {
+				for (double titleWidth : titleWidths) for (BTRCoreTextAlignment alignment : alignments) {
+					BTRCoreRect expected = ReferenceLabelFrame(bounds, image, arrow, titleWidth, alignment, 6, 3);
+					BTRCoreRect actual = BTRCorePopUpButtonLabelFrame(bounds, image, arrow, titleWidth, alignment, 6, 3);
+					if (!RectsEqual(actual, expected)) mismatches++;
+				}
+			}
+		}
+	}
+	BTR_EXPECT_EQUAL(mismatches, 0u);
+});
+
+BTR_TEST("control/popup_label_frame_follows_hooked_image", [] {
+	const BTRCoreRect bounds = { 0, 0, 200, 25 };
+	const BTRCoreRect arrow = BTRCorePopUpButtonArrowFrame(bounds, 7, 10, 6);
+	const BTRCoreRect image = { 40, 5, 16, 15 };
+	BTRCoreRect label = BTRCorePopUpButtonLabelFrame(bounds, image, arrow, 50, BTRCoreTextAlignmentLeft, 6, 3);
+	BTR_EXPECT_EQUAL(label.x, 59.0);
+	BTR_EXPECT_EQUAL(label.width, 50.0);
+	
+	// A wide hooked image narrows the label to the space left before the arrow.
+	const BTRCoreRect wideImage = { 6, 5, 150, 15 };
+	label = BTRCorePopUpButtonLabelFrame(bounds, wideImage, arrow, 50, BTRCoreTextAlignmentLeft, 6, 3);
+	BTR_EXPECT_EQUAL(label.width, 200.0 - 156 - 7 - 6 - 3 - 3);
+});
+
+} // namespace
@@ -0,0 +1,88 @@
+//
+//  BTRCoreFrameSchedulerTests.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include "BTRCoreFrameScheduler.h"
+
+#include <memory>
+#include <vector>
+
+using namespace btr::test;
+
+namespace {
+
+typedef std::unique_ptr<BTRCoreFrameScheduler, void (*)(BTRCoreFrameScheduler *)> SchedulerPointer;
+
+SchedulerPointer MakeScheduler() {
+	return SchedulerPointer(BTRCoreFrameSchedulerCreate(), &BTRCoreFrameSchedulerDestroy);
+}
+
+struct Recorder {
+	std::vector<double> timestamps;
+	BTRCoreFrameScheduler *scheduler = nullptr;
+	// The number of times the callback reschedules itself while firing.
+	int reschedules = 0;
+};
+
+void Record(double timestamp, void *context) {
+	Recorder *recorder = static_cast<Recorder *>(context);
+	recorder->timestamps.push_back(timestamp);
+	if (recorder->reschedules > 0) {
+		recorder->reschedules--;
+		BTRCoreFrameSchedulerSchedule(recorder->scheduler, Record, recorder, nullptr);
+	}
+}
+
+BTR_TEST("frame_scheduler/schedule_reports_idle", [] {
+	SchedulerPointer scheduler = MakeScheduler();
+	Recorder recorder;
+	bool wasIdle = false;
+	BTR_EXPECT(BTRCoreFrameSchedulerSchedule(scheduler.get(), Record, &recorder, &wasIdle));
+	BTR_EXPECT(wasIdle);
+	BTR_EXPECT(BTRCoreFrameSchedulerSchedule(scheduler.get(), Record, &recorder, &wasIdle));
+	BTR_EXPECT(!wasIdle);
+	BTR_EXPECT_EQUAL(BTRCoreFrameSchedulerGetPendingCount(scheduler.get()), 2u);
+});
+
+BTR_TEST("frame_scheduler/fire_calls_pending_once", [] {
+	SchedulerPointer scheduler = MakeScheduler();
+	Recorder recorder;
+	for (int i = 0; i < 20; i++) BTRCoreFrameSchedulerSchedule(scheduler.get(), Record, &recorder, nullptr);
+	BTR_EXPECT(!BTRCoreFrameSchedulerFire(scheduler.get(), 1.5));
+	BTR_EXPECT_EQUAL(recorder.timestamps.size(), 20u);
+	BTR_EXPECT_EQUAL(recorder.timestamps.back(), 1.5);
+	BTR_EXPECT_EQUAL(BTRCoreFrameSchedulerGetPendingCount(scheduler.get()), 0u);
+	
+	BTR_EXPECT(!BTRCoreFrameSchedulerFire(scheduler.get(), 2));
+	BTR_EXPECT_EQUAL(recorder.timestamps.size(), 20u);
+});
+
+BTR_TEST("frame_scheduler/rescheduled_callbacks_wait_for_next_frame", [] {
+	SchedulerPointer scheduler = MakeScheduler();
+	Recorder recorder;
+	recorder.scheduler = scheduler.get();
+	recorder.reschedules = 2;
+	BTRCoreFrameSchedulerSchedule(scheduler.get(), Record, &recorder, nullptr);
+	
+	BTR_EXPECT(BTRCoreFrameSchedulerFire(scheduler.get(), 1));
+	BTR_EXPECT_EQUAL(recorder.timestamps.size(), 1u);
+	BTR_EXPECT(BTRCoreFrameSchedulerFire(scheduler.get(), 2));
+	BTR_EXPECT(!BTRCoreFrameSchedulerFire(scheduler.get(), 3));
+	BTR_EXPECT(recorder.timestamps == std::vector<double>({ 1, 2, 3 }));
+});
+
+BTR_TEST("frame_scheduler/begin_frame_skips_until_fired", [] {
+	SchedulerPointer scheduler = MakeScheduler();
+	BTR_EXPECT(BTRCoreFrameSchedulerBeginFrame(scheduler.get()));
+	BTR_EXPECT(!BTRCoreFrameSchedulerBeginFrame(scheduler.get()));
+	BTRCoreFrameSchedulerFire(scheduler.get(), 0);
+	BTR_EXPECT(BTRCoreFrameSchedulerBeginFrame(scheduler.get()));
+});
+
+} // namespace
@@ -0,0 +1,93 @@
+//
+//  BTRCoreNineSliceTests.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include "BTRCoreNineSlice.h"
+
+using namespace btr::test;
+
+namespace {
+
+// Contents center
+
+BTR_TEST("nine_slice/contents_center_normalizes_insets", [] {
+	BTRCoreRect center = BTRCoreNineSliceContentsCenter(BTRCoreEdgeInsets{ 5, 10, 5, 10 }, 40, 20);
+	BTR_EXPECT_NEAR(center.x, 0.25, 1e-12);
+	BTR_EXPECT_NEAR(center.y, 0.25, 1e-12);
+	BTR_EXPECT_NEAR(center.width, 0.5, 1e-12);
+	BTR_EXPECT_NEAR(center.height, 0.5, 1e-12);
+});
+
+BTR_TEST("nine_slice/contents_center_keeps_overlapping_insets_in_points", [] {
+	// Insets that leave no center are passed through unnormalized, as they
+	// were by the AppKit implementation.
+	BTRCoreRect center = BTRCoreNineSliceContentsCenter(BTRCoreEdgeInsets{ 0, 12, 0, 12 }, 20, 10);
+	BTR_EXPECT_EQUAL(center.x, 12.0);
+	BTR_EXPECT_EQUAL(center.width, -4.0);
+	BTR_EXPECT_NEAR(center.height, 1.0, 1e-12);
+});
+
+// Segments
+
+BTR_TEST("nine_slice/segments_split_length", [] {
+	double segments[4];
+	BTRCoreNineSliceSegments(100, 10, 20, segments);
+	BTR_EXPECT_EQUAL(segments[0], 0.0);
+	BTR_EXPECT_EQUAL(segments[1], 10.0);
+	BTR_EXPECT_EQUAL(segments[2], 80.0);
+	BTR_EXPECT_EQUAL(segments[3], 100.0);
+});
+
+BTR_TEST("nine_slice/segments_shrink_caps_proportionally", [] {
+	double segments[4];
+	BTRCoreNineSliceSegments(15, 10, 20, segments);
+	BTR_EXPECT_NEAR(segments[1], 5.0, 1e-12);
+	BTR_EXPECT_NEAR(segments[2], 5.0, 1e-12);
+	
+	BTRCoreNineSliceSegments(15, -3, 5, segments);
+	BTR_EXPECT_EQUAL(segments[1], 0.0);
+	BTR_EXPECT_EQUAL(segments[2], 10.0);
+});
+
+// Layout
+
+BTR_TEST("nine_slice/layout_covers_destination", [] {
+	BTRCoreRect sources[9], destinations[9];
+	const BTRCoreRect destination = { 3, 4, 100, 50 };
+	BTRCoreNineSliceLayout(30, 20, BTRCoreEdgeInsets{ 5, 8, 6, 9 }, destination, sources, destinations);
+	
+	// The corners keep their size, and the center takes the rest.
+	BTR_EXPECT_EQUAL(destinations[0].x, 3.0);
+	BTR_EXPECT_EQUAL(destinations[0].y, 4.0);
+	BTR_EXPECT_EQUAL(destinations[0].width, 8.0);
+	BTR_EXPECT_EQUAL(destinations[0].height, 5.0);
+	BTR_EXPECT_EQUAL(destinations[8].width, 9.0);
+	BTR_EXPECT_EQUAL(destinations[8].height, 6.0);
+	BTR_EXPECT_EQUAL(destinations[4].width, 100.0 - 8 - 9);
+	BTR_EXPECT_EQUAL(destinations[4].height, 50.0 - 5 - 6);
+	BTR_EXPECT_EQUAL(sources[4].x, 8.0);
+	BTR_EXPECT_EQUAL(sources[4].width, 30.0 - 8 - 9);
+	
+	double area = 0;
+	for (int i = 0; i < 9; i++) area += destinations[i].width * destinations[i].height;
+	BTR_EXPECT_NEAR(area, destination.width * destination.height, 1e-9);
+});
+
+BTR_TEST("nine_slice/layout_zeroes_empty_slices", [] {
+	BTRCoreRect sources[9], destinations[9];
+	// No horizontal insets, so only the center column has any width.
+	BTRCoreNineSliceLayout(30, 20, BTRCoreEdgeInsets{ 5, 0, 5, 0 }, BTRCoreRect{ 0, 0, 60, 40 }, sources, destinations);
+	for (int row = 0; row < 3; row++) {
+		BTR_EXPECT_EQUAL(destinations[row * 3].width, 0.0);
+		BTR_EXPECT_EQUAL(sources[row * 3].height, 0.0);
+		BTR_EXPECT_EQUAL(destinations[row * 3 + 1].width, 60.0);
+	}
+});
+
+} // namespace
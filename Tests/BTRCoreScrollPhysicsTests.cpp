@@ -0,0 +1,44 @@
+//
+//  BTRCoreScrollPhysicsTests.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include "BTRCoreScrollPhysics.h"
+
+using namespace btr::test;
+
+namespace {
+
+BTR_TEST("scroll_physics/step_moves_fraction_of_distance", [] {
+	BTRCorePoint origin = { 0, 100 };
+	bool settled = BTRCoreScrollStep(&origin, BTRCorePoint{ 100, 0 }, 0.75);
+	BTR_EXPECT(!settled);
+	BTR_EXPECT_NEAR(origin.x, 25.0, 1e-12);
+	BTR_EXPECT_NEAR(origin.y, 75.0, 1e-12);
+});
+
+BTR_TEST("scroll_physics/step_settles_near_destination", [] {
+	BTRCorePoint origin = { 0, 0 };
+	const BTRCorePoint destination = { 500, -300 };
+	int frames = 0;
+	while (!BTRCoreScrollStep(&origin, destination, 0.8) && frames < 1000) frames++;
+	BTR_EXPECT(frames < 1000);
+	// The last frame moved less than the threshold, which bounds the remaining
+	// distance by a geometric series.
+	const double bound = BTRCoreScrollSettleThreshold * 0.8 / (1 - 0.8);
+	BTR_EXPECT_NEAR(origin.x, destination.x, bound);
+	BTR_EXPECT_NEAR(origin.y, destination.y, bound);
+});
+
+BTR_TEST("scroll_physics/step_at_destination_is_settled", [] {
+	BTRCorePoint origin = { 42, 42 };
+	BTR_EXPECT(BTRCoreScrollStep(&origin, BTRCorePoint{ 42, 42 }, 0.9));
+	BTR_EXPECT_EQUAL(origin.x, 42.0);
+});
+
+} // namespace
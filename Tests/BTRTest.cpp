@@ -0,0 +1,60 @@
+//
+//  BTRTest.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace btr {
+namespace test {
+
+static std::vector<Test> &Tests() {
+	static std::vector<Test> tests;
+	return tests;
+}
+
+void Register(const std::string &name, Function function) {
+	std::vector<Test> &tests = Tests();
+	for (size_t i = 0; i < tests.size(); i++) {
+		if (tests[i].name == name) {
+			std::fprintf(stderr, "Duplicate test name: %s\n", name.c_str());
+			std::abort();
+		}
+	}
+	Test test = { name, function };
+	tests.push_back(test);
+	std::sort(tests.begin(), tests.end(), [](const Test &a, const Test &b) { return a.name < b.name; });
+}
+
+const std::vector<Test> &RegisteredTests() {
+	return Tests();
+}
+
+static size_t currentFailures = 0;
+
+void Fail(const char *file, int line, const std::string &message) {
+	std::fprintf(stderr, "%s:%d: %s\n", file, line, message.c_str());
+	currentFailures++;
+}
+
+size_t Run(const std::string &prefix) {
+	size_t failedTests = 0;
+	for (const Test &test : Tests()) {
+		if (test.name.compare(0, prefix.size(), prefix) != 0) continue;
+		currentFailures = 0;
+		test.function();
+		std::printf("%s %s\n", currentFailures ? "FAIL" : "PASS", test.name.c_str());
+		if (currentFailures) failedTests++;
+	}
+	return failedTests;
+}
+
+} // namespace test
+} // namespace btr
@@ -0,0 +1,64 @@
+//
+//  BTRTest.hpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#ifndef BTR_TEST_HPP
+#define BTR_TEST_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace btr {
+namespace test {
+
+typedef std::function<void()> Function;
+
+struct Test {
+	std::string name;
+	Function function;
+};
+
+// Adds a test to the suite. Names are unique and run in sorted order.
+void Register(const std::string &name, Function function);
+const std::vector<Test> &RegisteredTests();
+
+// Records a failed expectation against the test that is currently running.
+void Fail(const char *file, int line, const std::string &message);
+
+// Runs the tests whose name starts with the prefix, printing each failure.
+// Returns the number of tests that failed.
+size_t Run(const std::string &prefix);
+
+} // namespace test
+} // namespace btr
+
+#define BTR_TEST_CONCAT_(a, b) a ## b
+#define BTR_TEST_CONCAT(a, b) BTR_TEST_CONCAT_(a, b)
+
+// Registers a test at static initialization time.
+#define BTR_TEST(name, ...) \
+	static const bool BTR_TEST_CONCAT(btrTestRegistered, __LINE__) = (::btr::test::Register(name, __VA_ARGS__), true)
+
+// Expectations record a failure and let the test continue.
+#define BTR_EXPECT(condition) \
+	do { \
+		if (!(condition)) ::btr::test::Fail(__FILE__, __LINE__, "expected " #condition); \
+	} while (0)
+
+#define BTR_EXPECT_EQUAL(actual, expected) \
+	do { \
+		if (!((actual) == (expected))) ::btr::test::Fail(__FILE__, __LINE__, "expected " #actual " == " #expected); \
+	} while (0)
+
+#define BTR_EXPECT_NEAR(actual, expected, accuracy) \
+	do { \
+		double btrDifference = (double)(actual) - (double)(expected); \
+		if (btrDifference > (accuracy) || btrDifference < -(accuracy)) ::btr::test::Fail(__FILE__, __LINE__, "expected " #actual " to be near " #expected); \
+	} while (0)
+
+#endif
@@ -0,0 +1,39 @@
+//
+//  main.cpp
+//  Butter
+//
+//  Created by ButterKit on 10/19/26.
+//  Copyright (c) 2026 ButterKit. All rights reserved.
+//
+
+#include "BTRTest.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace btr::test;
+
+int main(int argc, char **argv) {
+	std::string prefix;
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--list") == 0) {
+			for (const Test &test : RegisteredTests()) {
+				std::printf("%s\n", test.name.c_str());
+			}
+			return 0;
+		} else if (argv[i][0] != '-') {
+			prefix = argv[i];
+		} else {
+			std::fprintf(stderr, "usage: %s [--list] [name prefix]\n", argv[0]);
+			return 2;
+		}
+	}
+	
+	size_t failed = Run(prefix);
+	if (failed) {
+		std::fprintf(stderr, "%zu test(s) failed\n", failed);
+		return 1;
+	}
+	return 0;
+}